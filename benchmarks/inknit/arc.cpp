@@ -0,0 +1,228 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, le)
+#define TYPES         std::tuple<int32_t, int32_t, int32_t, int32_t, int32_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name)        INKBM_FIXTURE_APPLY(name, draw_arc, d_arc)
+#define APPLY_SECTOR(name) INKBM_FIXTURE_APPLY(name, fill_sector, d_arc)
+#define APPLY_RING(name)   INKBM_FIXTURE_APPLY(name, fill_ring, d_arc)
+
+class d_arc: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [cx, cy, radius, start, end] = *ptr;
+
+		cx_     = cx;
+		cy_     = cy;
+		radius_ = radius;
+		start_  = start;
+		end_    = end;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
+	std::int32_t cx_, cy_, radius_, start_, end_;
+};
+
+// Progress gauges start at the top and run clockwise
+INKBM_ARGS(
+	draw_arc,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {cx, cy, radius, start, end}},
+
+		{"a10_gauge",  "10% of a 35px gauge",          TYPES {64, 40, 35, -90, -54}},
+		{"a50_gauge",  "50% of a 35px gauge",          TYPES {64, 40, 35, -90,  90}},
+		{"a90_gauge",  "90% of a 35px gauge",          TYPES {64, 40, 35, -90, 234}},
+		{"a100_gauge", "whole 35px gauge",             TYPES {64, 40, 35, -90, 270}},
+		{"a10_small",  "10% of a 10px spinner",        TYPES {20, 20, 10, -90, -54}},
+		{"a90_small",  "90% of a 10px spinner",        TYPES {20, 20, 10, -90, 234}},
+		{"a50_clip",   "50% of a 60px arc, clipped",   TYPES {64, 70, 60, 180, 360}},
+	},
+	// clang-format on
+);
+
+// Walks the whole circle and tests every pixel against the wedge
+APPLY(points) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_arc_points, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			start_,
+			end_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+// Walks the rows the wedge reaches and bounds each with the wedge
+APPLY(rows) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_arc_rows, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			start_,
+			end_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+// Runs of the circle walk, tested pixel by pixel only in the octants holding a ray
+APPLY(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_arc_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			start_,
+			end_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+// The whole circle, for reference
+APPLY(circle) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_circle_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	fill_sector,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {cx, cy, radius, start, end}},
+
+		{"s10_pie",  "10% of a 35px pie",          TYPES {64, 40, 35, -90, -54}},
+		{"s50_pie",  "50% of a 35px pie",          TYPES {64, 40, 35, -90,  90}},
+		{"s90_pie",  "90% of a 35px pie",          TYPES {64, 40, 35, -90, 234}},
+		{"s50_clip", "50% of a 60px pie, clipped", TYPES {64, 70, 60, 180, 360}},
+	},
+	// clang-format on
+);
+
+APPLY_SECTOR(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_sector_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			start_,
+			end_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+// The whole disc, for reference, which is also what a whole turn of the sector calls
+APPLY_SECTOR(circle) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_circle_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	fill_ring,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {cx, cy, radius, start, end}},
+
+		{"r10_gauge", "10% of a 35px gauge", TYPES {64, 40, 35, -90, -54}},
+		{"r50_gauge", "50% of a 35px gauge", TYPES {64, 40, 35, -90,  90}},
+		{"r90_gauge", "90% of a 35px gauge", TYPES {64, 40, 35, -90, 234}},
+	},
+	// clang-format on
+);
+
+// A 6px band, a typical gauge track
+APPLY_RING(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_ring_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			6,
+			start_,
+			end_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
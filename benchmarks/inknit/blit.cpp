@@ -170,3 +170,268 @@ APPLY(mask) {
 		);
 	}
 }
+
+#define ROP_GROUP INKNIT_INTERNAL_GROUP(32, 4, be)
+
+#define APPLY_ROP(name) INKBM_FIXTURE_APPLY(name, blit_rop, f_blit_rop)
+
+// Sprite with a transparent (black) background on an x4 framebuffer
+class f_blit_rop: public f_blit {
+public:
+	explicit f_blit_rop() {
+		sprite_.clear(COLOR_BLACK);
+		for (std::int32_t y = 0; y < sprite_.height(); ++y) {
+			for (std::int32_t x = 0; x < sprite_.width(); ++x) {
+				if (((x / 8) + (y / 8)) % 2 != 0) {
+					sprite_.draw_point(x, y, static_cast<color_t>((x + y) % 15 + 1));
+				}
+			}
+		}
+	}
+
+	void setup() noexcept override {
+		screen_.clear(COLOR_WHITE);
+	}
+
+protected:
+	fixed_image<96, 96, pixel_layout::x4, pixel_format::grayscale> sprite_;
+	fixed_image<96, 96, pixel_layout::x4, pixel_format::grayscale> screen_;
+};
+
+INKBM_ARGS(
+	blit_rop,
+	"Test Method",
+	// clang-format off
+	{
+		{"b_sq_64_a",  "64x64 square, aligned", TYPES {32, 32, 32, 32, 64, 64}},
+		{"b_32_u_u",   "32x32, src/dst unaligned", TYPES {33, 10, 35, 10, 32, 32}},
+		{"b_48_bnd_m", "48x16, crosses multiple boundaries", TYPES {24, 10, 24, 10, 48, 16}},
+	},
+	// clang-format on
+);
+
+// What callers did before blit_rop: a per-pixel color-key loop
+APPLY_ROP(key_pixel) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		for (inknit_uint_t y = 0; y < height_; ++y) {
+			for (inknit_uint_t x = 0; x < width_; ++x) {
+				auto const    sx    = static_cast<std::int32_t>(sx_ + x);
+				auto const    sy    = static_cast<std::int32_t>(sy_ + y);
+				color_t const color = sprite_.at(sx, sy);
+				if (color != COLOR_BLACK) {
+					auto const dx = static_cast<std::int32_t>(dx_ + x);
+					auto const dy = static_cast<std::int32_t>(dy_ + y);
+					screen_.draw_point(dx, dy, color);
+				}
+			}
+		}
+	}
+}
+
+APPLY_ROP(key) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(blit_rop, ROP_GROUP)(
+			&screen_, dx_, dy_, &sprite_, sx_, sy_, width_, height_, INKNIT_ROP_KEY, 0
+		);
+	}
+}
+
+APPLY_ROP(xor) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(blit_rop, ROP_GROUP)(
+			&screen_, dx_, dy_, &sprite_, sx_, sy_, width_, height_, INKNIT_ROP_XOR, 0
+		);
+	}
+}
+
+#define APPLY_CONVERT(name) INKBM_FIXTURE_APPLY(name, blit_convert, f_blit_rop)
+
+INKBM_ARGS(
+	blit_convert,
+	"Test Method",
+	// clang-format off
+	{
+		{"b_sq_16_a", "16x16 icon, aligned",   TYPES {32, 32, 32, 32, 16, 16}},
+		{"b_sq_64_a", "64x64 square, aligned", TYPES {32, 32, 32, 32, 64, 64}},
+		{"b_32_u_u",  "32x32, src/dst unaligned", TYPES {33, 10, 35, 10, 32, 32}},
+	},
+	// clang-format on
+);
+
+// What callers did before blit_convert: x1lsb get_pixel -> x4 draw_point
+APPLY_CONVERT(pixel) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		for (inknit_uint_t y = 0; y < height_; ++y) {
+			for (inknit_uint_t x = 0; x < width_; ++x) {
+				auto const    sx    = static_cast<std::int32_t>(sx_ + x);
+				auto const    sy    = static_cast<std::int32_t>(sy_ + y);
+				color_t const color = src_.at(sx, sy) != COLOR_BLACK ? 15 : 0;
+				auto const    dx    = static_cast<std::int32_t>(dx_ + x);
+				auto const    dy    = static_cast<std::int32_t>(dy_ + y);
+				screen_.draw_point(dx, dy, color);
+			}
+		}
+	}
+}
+
+APPLY_CONVERT(lut) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		screen_.blit_convert(
+			static_cast<std::int32_t>(dx_),
+			static_cast<std::int32_t>(dy_),
+			src_,
+			static_cast<std::int32_t>(sx_),
+			static_cast<std::int32_t>(sy_),
+			static_cast<std::int32_t>(width_),
+			static_cast<std::int32_t>(height_)
+		);
+	}
+}
+
+#ifdef INKNIT_ENABLE_SPAN_SIMD
+#define SPAN_TYPES std::tuple<std::uint32_t>
+
+#define APPLY_SPAN(name) INKBM_FIXTURE_APPLY(name, blit_span, f_blit_span)
+
+// Row copy of an aligned blit on an x4 framebuffer
+class f_blit_span: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<SPAN_TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [width] = *ptr;
+
+		bytes_ = width / 2;
+	}
+
+	void setup() noexcept override {
+		src_.clear(COLOR_WHITE);
+		dst_.clear(COLOR_BLACK);
+	}
+
+protected:
+	// One spare word: the stitch kernels read one byte past the span.
+	fixed_image<1880, 1, pixel_layout::x4, pixel_format::grayscale> src_;
+	fixed_image<1872, 1, pixel_layout::x4, pixel_format::grayscale> dst_;
+
+	std::uint32_t bytes_;
+};
+
+INKBM_ARGS(
+	blit_span,
+	"Test Method",
+	// clang-format off
+	{
+		{"w0016", "16px row (2 words)",        SPAN_TYPES {  16}},
+		{"w0064", "64px row (8 words)",        SPAN_TYPES {  64}},
+		{"w0256", "256px row (32 words)",      SPAN_TYPES { 256}},
+		{"w1872", "1872px row (e-ink x4 row)", SPAN_TYPES {1872}},
+	},
+	// clang-format on
+);
+
+APPLY_SPAN(scalar) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_copy_scalar(dst_.data(), src_.data(), bytes_);
+	}
+}
+
+#ifdef INKNIT_ENABLE_SPAN_SSE2
+APPLY_SPAN(sse2) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_copy_sse2(dst_.data(), src_.data(), bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_AVX2
+APPLY_SPAN(avx2) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_copy_avx2(dst_.data(), src_.data(), bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_NEON
+APPLY_SPAN(neon) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_copy_neon(dst_.data(), src_.data(), bytes_);
+	}
+}
+#endif
+
+#define APPLY_SWAP_ORDER(name) INKBM_FIXTURE_APPLY(name, blit_swap_order, f_blit_span)
+
+INKBM_ARGS(
+	blit_swap_order,
+	"Test Method",
+	// clang-format off
+	{
+		{"w0064", "64px row (8 words)",        SPAN_TYPES {  64}},
+		{"w0256", "256px row (32 words)",      SPAN_TYPES { 256}},
+		{"w1872", "1872px row (e-ink x4 row)", SPAN_TYPES {1872}},
+	},
+	// clang-format on
+);
+
+APPLY_SWAP_ORDER(scalar) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_swap_order_scalar(dst_.data(), src_.data(), 4, bytes_);
+	}
+}
+
+#ifdef INKNIT_ENABLE_SPAN_SSE2
+APPLY_SWAP_ORDER(sse2) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_swap_order_sse2(dst_.data(), src_.data(), 4, bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_AVX2
+APPLY_SWAP_ORDER(avx2) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_swap_order_avx2(dst_.data(), src_.data(), 4, bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_NEON
+APPLY_SWAP_ORDER(neon) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_swap_order_neon(dst_.data(), src_.data(), 4, bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_STITCH
+#define APPLY_STITCH(name) INKBM_FIXTURE_APPLY(name, blit_stitch, f_blit_span)
+
+INKBM_ARGS(
+	blit_stitch,
+	"Test Method",
+	// clang-format off
+	{
+		{"w0064", "64px row (8 words)",        SPAN_TYPES {  64}},
+		{"w0256", "256px row (32 words)",      SPAN_TYPES { 256}},
+		{"w1872", "1872px row (e-ink x4 row)", SPAN_TYPES {1872}},
+	},
+	// clang-format on
+);
+
+APPLY_STITCH(scalar) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_stitch_msb_scalar(dst_.data(), src_.data(), 4, bytes_);
+	}
+}
+
+APPLY_STITCH(neon) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_stitch_msb_neon(dst_.data(), src_.data(), 4, bytes_);
+	}
+}
+#endif
+#endif
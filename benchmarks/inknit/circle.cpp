@@ -18,17 +18,19 @@
  */
 
 #include "inknit.hpp"
+#include "inknit_internal.h"
 #include "utils/inkbm.hpp"
 #include "constants.hpp"
 
 using namespace inknit;
 using namespace inkbm;
 
-#define CURRENT_LAYOUT x1lsb
+#define CURRENT_GROUP  INKNIT_INTERNAL_GROUP(32, 1, le)
 #define TYPES          std::tuple<std::int32_t, std::int32_t, std::int32_t>
 #define ITERATIONS     DEFAULT_ITERATIONS
 
-#define APPLY(name) INKBM_FIXTURE_APPLY(name, draw_circle, d_circle)
+#define APPLY(name)      INKBM_FIXTURE_APPLY(name, draw_circle, d_circle)
+#define APPLY_FILL(name) INKBM_FIXTURE_APPLY(name, fill_circle, f_circle)
 
 class d_circle: public fixture {
 public:
@@ -52,9 +54,22 @@ public:
 protected:
 	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
 
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
 	std::int32_t cx_, cy_, radius_;
 };
 
+// Reports the pixels written by the last call, so rows written more than once show up as overdraw
+class f_circle: public d_circle {
+public:
+	counter work() const noexcept override {
+		return {"pixel writes", writes_};
+	}
+
+protected:
+	std::uint64_t writes_ {0};
+};
+
 INKBM_ARGS(
 	draw_circle,
 	"Test Method",
@@ -81,12 +96,117 @@ INKBM_ARGS(
 		{"c_r1",         "1-pixel radius circle",              TYPES {12, 12,  1}},
 		{"cr20_q1_clip", "20px radius, center in Q1, clipped", TYPES { 8,  8, 20}},
 		//{"cr30_most_off", "30px radius, mostly off-screen",    TYPES {-15, -15, 30}},
+		{"cr10_off",     "10px radius, entirely off-screen",   TYPES {-20, 40, 10}},
+
+		// -- large radii
+		// Long runs near the top and bottom, where many pixels share a word.
+		{"cr39_fit",   "39px radius, fills the image height", TYPES {64, 40,  39}},
+		{"cr60_clip",  "60px radius, top and bottom clipped", TYPES {64, 40,  60}},
+		{"cr100_edge", "100px radius, only the sides inside", TYPES {64, 40, 100}},
 	},
 	// clang-format on
 );
 
 APPLY(midpoint) {
 	for (int i = 0; i < ITERATIONS; ++i) {
-		INKNIT_PUBLIC_FUNC(draw_circle, CURRENT_LAYOUT)(&image_, cx_, cy_, radius_, COLOR_WHITE);
+		INKNIT_INTERNAL_FUNC(draw_circle_midpoint, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(spans) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_circle_spans, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+// Skips clipping when the bounding box is inside and drawing when it is outside
+APPLY(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_circle_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	fill_circle,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {cx, cy, radius}},
+
+		{"cr05_small",  "5px radius circle, offset",           TYPES {10, 12,  5}},
+		{"cr15_medium", "15px radius circle, offset",          TYPES {20, 22, 15}},
+		{"cr35_large",  "35px radius large circle",            TYPES {40, 40, 35}},
+		{"cr39_fit",    "39px radius, fills the image height", TYPES {64, 40, 39}},
+		{"cr60_clip",   "60px radius, top and bottom clipped", TYPES {64, 40, 60}},
+		{"cr20_q1_clip", "20px radius, center in Q1, clipped", TYPES { 8,  8, 20}},
+		{"cr10_off",     "10px radius, entirely off-screen",   TYPES {-20, 40, 10}},
+	},
+	// clang-format on
+);
+
+APPLY_FILL(midpoint) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		writes_ = INKNIT_INTERNAL_FUNC(fill_circle_midpoint, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_FILL(spans) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		writes_ = INKNIT_INTERNAL_FUNC(fill_circle_spans, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_FILL(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_circle_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			radius_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
 	}
 }
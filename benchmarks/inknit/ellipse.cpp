@@ -0,0 +1,207 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, le)
+#define TYPES         std::tuple<std::int32_t, std::int32_t, std::int32_t, std::int32_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name)      INKBM_FIXTURE_APPLY(name, draw_ellipse, d_ellipse)
+#define APPLY_FILL(name) INKBM_FIXTURE_APPLY(name, fill_ellipse, f_ellipse)
+
+class d_ellipse: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [cx, cy, rx, ry] = *ptr;
+
+		cx_ = cx;
+		cy_ = cy;
+		rx_ = rx;
+		ry_ = ry;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
+	std::int32_t cx_, cy_, rx_, ry_;
+};
+
+// Reports the pixels written by the last call, so rows written more than once show up as overdraw
+class f_ellipse: public d_ellipse {
+public:
+	counter work() const noexcept override {
+		return {"pixel writes", writes_};
+	}
+
+protected:
+	std::uint64_t writes_ {0};
+};
+
+INKBM_ARGS(
+	draw_ellipse,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {cx, cy, rx, ry}},
+
+		// -- basic ellipses
+		{"er08x04_small", "8x4px radii, offset",   TYPES {12, 10,  8,  4}},
+		{"er20x10_wide",  "20x10px radii, wide",   TYPES {30, 20, 20, 10}},
+		{"er10x20_tall",  "10x20px radii, tall",   TYPES {20, 30, 10, 20}},
+
+		// -- large radii
+		// Long horizontal runs in region 1 and long vertical runs in region 2.
+		{"er63x39_fit",   "63x39px radii, fills the image", TYPES {64, 40,  63, 39}},
+		{"er60x12_flat",  "60x12px radii, flat",            TYPES {64, 40,  60, 12}},
+		{"er12x39_thin",  "12x39px radii, thin",            TYPES {64, 40,  12, 39}},
+		{"er100x60_clip", "100x60px radii, mostly clipped", TYPES {64, 40, 100, 60}},
+
+		// -- clipping
+		{"er20x10_q1_clip", "20x10px radii, center in Q1, clipped", TYPES {  8,  4, 20, 10}},
+		{"er20x10_off",     "20x10px radii, entirely off-screen",   TYPES {160, 40, 20, 10}},
+	},
+	// clang-format on
+);
+
+APPLY(midpoint) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_ellipse_midpoint, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			rx_,
+			ry_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(spans) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_ellipse_spans, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			rx_,
+			ry_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+// Skips clipping when the bounding box is inside and drawing when it is outside
+APPLY(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_ellipse_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			rx_,
+			ry_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	fill_ellipse,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {cx, cy, rx, ry}},
+
+		{"er20x10_wide",  "20x10px radii, wide",            TYPES {30, 20,  20, 10}},
+		{"er10x20_tall",  "10x20px radii, tall",            TYPES {20, 30,  10, 20}},
+		{"er63x39_fit",   "63x39px radii, fills the image", TYPES {64, 40,  63, 39}},
+		{"er60x12_flat",  "60x12px radii, flat",            TYPES {64, 40,  60, 12}},
+		{"er100x60_clip", "100x60px radii, mostly clipped", TYPES {64, 40, 100, 60}},
+		{"er20x10_q1_clip", "20x10px radii, center in Q1, clipped", TYPES {  8,  4, 20, 10}},
+		{"er20x10_off",     "20x10px radii, entirely off-screen",   TYPES {160, 40, 20, 10}},
+	},
+	// clang-format on
+);
+
+APPLY_FILL(midpoint) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		writes_ = INKNIT_INTERNAL_FUNC(fill_ellipse_midpoint, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			rx_,
+			ry_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_FILL(spans) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		writes_ = INKNIT_INTERNAL_FUNC(fill_ellipse_spans, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			rx_,
+			ry_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_FILL(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_ellipse_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			cx_,
+			cy_,
+			rx_,
+			ry_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
@@ -0,0 +1,113 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 2, be)
+#define TYPES         std::tuple<std::int32_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name) INKBM_FIXTURE_APPLY(name, flood_fill, f_flood_fill)
+
+// Walls take the third color and each fill swaps the region between the first two, so every
+// iteration fills the same region
+#define COLOR_WALL 3
+
+class f_flood_fill: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [scene] = *ptr;
+
+		image_.clear(COLOR_BLACK);
+		switch (scene) {
+		case 1:  // window
+			image_.draw_rect({60, 60}, {200, 120}, COLOR_WALL);
+			break;
+		case 2:  // comb
+			for (std::int32_t x = 8; x < 312; x += 16) {
+				image_.draw_vline(x, 0, 231, COLOR_WALL);
+				image_.draw_vline(x + 8, 8, 239, COLOR_WALL);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+protected:
+	fixed_image<320, 240, pixel_layout::x2, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 320, 240};
+
+	inknit_flood_span scratch_[256];
+};
+
+INKBM_ARGS(
+	flood_fill,
+	"Test Method",
+	// clang-format off
+	{
+		{"open",   "whole image (320x240)",         TYPES {0}},
+		{"window", "inside a 200x120 window",       TYPES {1}},
+		{"comb",   "winding around 39 comb teeth",  TYPES {2}},
+	},
+	// clang-format on
+);
+
+// Reads and writes one pixel at a time
+APPLY(pixels) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(flood_fill_pixels, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			100,
+			100,
+			1 + (i & 1),
+			scratch_,
+			256,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(flood_fill_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			100,
+			100,
+			1 + (i & 1),
+			scratch_,
+			256,
+			&clip_rect_
+		);
+	}
+}
@@ -96,3 +96,96 @@ APPLY(lut) {
 		);
 	}
 }
+
+#ifdef INKNIT_ENABLE_WORD64
+#define CURRENT_GROUP64 INKNIT_INTERNAL_GROUP(64, 1, le)
+
+APPLY(arith64) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_hline_arith, CURRENT_GROUP64)(
+			reinterpret_cast<uint64_t *>(image_.data()), image_.stride(), x1_, x2_, y_, COLOR_WHITE
+		);
+	}
+}
+
+APPLY(lut64) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_hline_lut, CURRENT_GROUP64)(
+			reinterpret_cast<uint64_t *>(image_.data()), image_.stride(), x1_, x2_, y_, COLOR_WHITE
+		);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_SIMD
+#define SPAN_TYPES std::tuple<std::uint32_t>
+
+#define APPLY_SPAN(name) INKBM_FIXTURE_APPLY(name, draw_hline_span, d_hline_span)
+
+// Middle-word fill of a single hline on an x4 framebuffer
+class d_hline_span: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<SPAN_TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [width] = *ptr;
+
+		bytes_ = width / 2;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<1872, 1, pixel_layout::x4, pixel_format::grayscale> image_;
+
+	std::uint32_t bytes_;
+};
+
+INKBM_ARGS(
+	draw_hline_span,
+	"Test Method",
+	// clang-format off
+	{
+		{"w0016", "16px span (2 words)",        SPAN_TYPES {  16}},
+		{"w0064", "64px span (8 words)",        SPAN_TYPES {  64}},
+		{"w0256", "256px span (32 words)",      SPAN_TYPES { 256}},
+		{"w1872", "1872px span (e-ink x4 row)", SPAN_TYPES {1872}},
+	},
+	// clang-format on
+);
+
+APPLY_SPAN(scalar) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_fill_scalar(image_.data(), 0xFF, bytes_);
+	}
+}
+
+#ifdef INKNIT_ENABLE_SPAN_SSE2
+APPLY_SPAN(sse2) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_fill_sse2(image_.data(), 0xFF, bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_AVX2
+APPLY_SPAN(avx2) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_fill_avx2(image_.data(), 0xFF, bytes_);
+	}
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_NEON
+APPLY_SPAN(neon) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		_inknit_span_fill_neon(image_.data(), 0xFF, bytes_);
+	}
+}
+#endif
+#endif
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <vector>  // vector
+
 #include "inknit.hpp"
 #include "inknit_internal.h"
 #include "utils/inkbm.hpp"
@@ -114,3 +116,76 @@ APPLY(1loop) {
 		);
 	}
 }
+
+APPLY(runslice) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_line_runslice, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()), image_.stride(), x1_, y1_, x2_, y2_, COLOR_WHITE
+		);
+	}
+}
+
+#undef TYPES
+#define TYPES std::tuple<std::int32_t, std::int32_t>
+
+#define APPLY_POLYLINE(name) INKBM_FIXTURE_APPLY(name, draw_polyline, d_polyline)
+
+class d_polyline: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [count, amplitude] = *ptr;
+
+		// Zigzag chart across the image, centered vertically
+		points_.clear();
+		for (std::int32_t i = 0; i < count; ++i) {
+			std::int32_t const dy = (i % 2 ? amplitude : -amplitude) * (i % 5) / 4;
+			std::int32_t const x  = i * (image_.width() - 1) / (count - 1);
+			std::int32_t const y  = image_.height() / 2 + dy;
+			points_.push_back({static_cast<std::int16_t>(x), static_cast<std::int16_t>(y)});
+		}
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<128, 72, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	std::vector<inknit_point> points_;
+};
+
+INKBM_ARGS(
+	draw_polyline,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {count, amplitude}},
+		{"p16_chart", "16 points, inside",                   TYPES {16, 20}},
+		{"p64_chart", "64 points, inside",                   TYPES {64, 20}},
+		{"p64_flat",  "64 points, short shallow segments",   TYPES {64, 2}},
+		{"p64_clip",  "64 points, peaks outside the image",  TYPES {64, 60}},
+	},
+	// clang-format on
+);
+
+APPLY_POLYLINE(lines) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		for (std::size_t j = 1; j < points_.size(); ++j) {
+			inknit_point const& p1 = points_[j - 1];
+			inknit_point const& p2 = points_[j];
+			image_.draw_line({p1.x, p1.y}, {p2.x, p2.y}, COLOR_WHITE);
+		}
+	}
+}
+
+APPLY_POLYLINE(polyline) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		image_.draw_polyline(points_, COLOR_WHITE);
+	}
+}
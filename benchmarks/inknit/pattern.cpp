@@ -0,0 +1,126 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, be)
+#define TYPES         std::tuple<std::int32_t, std::int32_t, std::int32_t, std::int32_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name) INKBM_FIXTURE_APPLY(name, fill_rect_pattern, f_rect_pattern)
+
+class f_rect_pattern: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [x1, y1, x2, y2] = *ptr;
+
+		x1_ = x1;
+		y1_ = y1;
+		x2_ = x2;
+		y2_ = y2;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+		inknit_make_dither_pattern(pattern_, 24);
+	}
+
+protected:
+	fixed_image<320, 240, pixel_layout::x1, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 320, 240};
+
+	std::uint8_t pattern_[8];
+	std::int32_t x1_, y1_, x2_, y2_;
+};
+
+INKBM_ARGS(
+	fill_rect_pattern,
+	"Test Method",
+	// clang-format off
+	{
+		{"full",   "full-screen gray (320x240)",     TYPES {  0,   0, 319, 239}},
+		{"row",    "gray list row (320x24)",         TYPES {  0,  48, 319,  71}},
+		{"button", "unaligned gray button (198x32)", TYPES { 13, 100, 210, 131}},
+		{"small",  "small unaligned rect (16x16)",   TYPES { 10,  10,  25,  25}},
+	},
+	// clang-format on
+);
+
+// One inknit_draw_point per pixel, as dithered fills were drawn before
+APPLY(points) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_pattern_points, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			pattern_,
+			COLOR_WHITE,
+			COLOR_BLACK,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_pattern_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			pattern_,
+			COLOR_WHITE,
+			COLOR_BLACK,
+			&clip_rect_
+		);
+	}
+}
+
+// The solid fill of the same rect, which the pattern fill should match
+APPLY(solid) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
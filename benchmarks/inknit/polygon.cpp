@@ -0,0 +1,217 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>  // max, min
+
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, le)
+#define TRIANGLE      std::tuple<point_t, point_t, point_t>
+#define QUAD          std::tuple<point_t, point_t, point_t, point_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY_TRIANGLE(name) INKBM_FIXTURE_APPLY(name, fill_triangle, f_triangle)
+#define APPLY_QUAD(name)     INKBM_FIXTURE_APPLY(name, fill_quad, f_quad)
+
+class f_polygon: public fixture {
+public:
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	void load_points(std::initializer_list<point_t> points) noexcept {
+		count_ = 0;
+		for (auto [x, y] : points) {
+			points_[count_++] = {static_cast<std::int16_t>(x), static_cast<std::int16_t>(y)};
+		}
+	}
+
+	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
+	inknit_point        points_[4];
+	inknit_polygon_edge edges_[4];
+	std::uint32_t       count_;
+};
+
+class f_triangle: public f_polygon {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TRIANGLE>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [pt1, pt2, pt3] = *ptr;
+		load_points({pt1, pt2, pt3});
+	}
+};
+
+// Also keeps the bounding box, which is the same shape as the quad when it is an upright rectangle
+class f_quad: public f_polygon {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<QUAD>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [pt1, pt2, pt3, pt4] = *ptr;
+		load_points({pt1, pt2, pt3, pt4});
+
+		left_   = std::min({pt1.first, pt2.first, pt3.first, pt4.first});
+		top_    = std::min({pt1.second, pt2.second, pt3.second, pt4.second});
+		right_  = std::max({pt1.first, pt2.first, pt3.first, pt4.first}) - 1;
+		bottom_ = std::max({pt1.second, pt2.second, pt3.second, pt4.second}) - 1;
+	}
+
+protected:
+	std::int32_t left_, top_, right_, bottom_;
+};
+
+INKBM_ARGS(
+	fill_triangle,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TRIANGLE {pt1, pt2, pt3}},
+
+		{"t08_needle", "8px gauge needle",   TRIANGLE {{ 60,   4}, { 68,   4}, { 64,  76}}},
+		{"t16_icon",   "16px icon arrow",    TRIANGLE {{ 20,  10}, { 36,  18}, { 20,  26}}},
+		{"t40_large",  "large triangle",     TRIANGLE {{ 10,   5}, { 90,  30}, { 40,  75}}},
+		{"t_flat_top", "flat top",           TRIANGLE {{  0,   0}, {127,   0}, { 64,  79}}},
+		{"t_shallow",  "shallow sliver",     TRIANGLE {{  0,  30}, {127,  34}, {  0,  36}}},
+		{"t_clip",     "crosses every edge", TRIANGLE {{-30,  40}, {100, -40}, {160, 120}}},
+		{"t_off",      "off-screen",         TRIANGLE {{-40,  10}, {-10,  20}, {-30,  50}}},
+	},
+	// clang-format on
+);
+
+// Solves both crossings of every row on their own and writes each row with the clipped hline
+APPLY_TRIANGLE(hlines) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_triangle_hlines, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			points_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_TRIANGLE(edges) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_polygon_edges, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			points_,
+			count_,
+			COLOR_WHITE,
+			INKNIT_FILL_EVEN_ODD,
+			edges_,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_TRIANGLE(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_convex_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			points_,
+			count_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	fill_quad,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", QUAD {pt1, pt2, pt3, pt4}},
+
+		{"q_button",  "upright 48x16 button", QUAD {{ 13,  20}, { 61,  20}, { 61,  36}, {13,  36}}},
+		{"q_full",    "upright, whole image", QUAD {{  0,   0}, {128,   0}, {128,  80}, { 0,  80}}},
+		{"q_tilted",  "tilted by 30 deg",     QUAD {{ 50,  10}, { 85,  30}, { 65,  65}, {30,  45}}},
+		{"q_diamond", "diamond",              QUAD {{ 64,   0}, {104,  40}, { 64,  80}, {24,  40}}},
+		{"q_clip",    "crosses every edge",   QUAD {{-20,  30}, { 70, -30}, {150,  50}, {60, 110}}},
+	},
+	// clang-format on
+);
+
+APPLY_QUAD(edges) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_polygon_edges, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			points_,
+			count_,
+			COLOR_WHITE,
+			INKNIT_FILL_EVEN_ODD,
+			edges_,
+			&clip_rect_
+		);
+	}
+}
+
+// Takes the convex path after the convexity test
+APPLY_QUAD(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_polygon_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			points_,
+			count_,
+			COLOR_WHITE,
+			INKNIT_FILL_EVEN_ODD,
+			edges_,
+			&clip_rect_
+		);
+	}
+}
+
+// Fills the bounding box, which is the same shape for the upright quads
+APPLY_QUAD(fill_rect) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			left_,
+			top_,
+			right_,
+			bottom_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
@@ -0,0 +1,96 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 4, be)
+#define TYPES         std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name) INKBM_FIXTURE_APPLY(name, fill_rect, f_rect)
+
+class f_rect: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [x1, y1, x2, y2] = *ptr;
+
+		x1_ = x1;
+		y1_ = y1;
+		x2_ = x2;
+		y2_ = y2;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<320, 240, pixel_layout::x4, pixel_format::grayscale> image_;
+
+	std::uint32_t x1_, y1_, x2_, y2_;
+};
+
+INKBM_ARGS(
+	fill_rect,
+	"Test Method",
+	// clang-format off
+	{
+		{"full",   "full-screen background (320x240)",  TYPES {  0,   0, 319, 239}},
+		{"row",    "list highlight (320x24)",           TYPES {  0,  48, 319,  71}},
+		{"button", "unaligned button (198x32)",         TYPES { 13, 100, 210, 131}},
+		{"small",  "small unaligned rect (16x16)",      TYPES { 10,  10,  25,  25}},
+		{"bar2w",  "tall narrow bar, 2 words (8x240)",  TYPES {  5,   0,  12, 239}},
+		{"bar1w",  "tall narrow bar, 1 word (5x240)",   TYPES {  2,   0,   6, 239}},
+	},
+	// clang-format on
+);
+
+APPLY(hline) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_hline, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()), image_.stride(), x1_, y1_, x2_, y2_, COLOR_WHITE
+		);
+	}
+}
+
+APPLY(rows) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_rows, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()), image_.stride(), x1_, y1_, x2_, y2_, COLOR_WHITE
+		);
+	}
+}
+
+APPLY(columns) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_rect_columns, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()), image_.stride(), x1_, y1_, x2_, y2_, COLOR_WHITE
+		);
+	}
+}
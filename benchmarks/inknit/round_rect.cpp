@@ -0,0 +1,222 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, le)
+#define TYPES         std::tuple<int32_t, int32_t, int32_t, int32_t, int32_t>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name)      INKBM_FIXTURE_APPLY(name, draw_round_rect, f_round_rect)
+#define APPLY_FILL(name) INKBM_FIXTURE_APPLY(name, fill_round_rect, f_round_rect)
+
+// Keeps the corner table of the radius, as a caller drawing the same widget again would
+class f_round_rect: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [x, y, width, height, radius] = *ptr;
+
+		x1_     = x;
+		y1_     = y;
+		x2_     = x + width - 1;
+		y2_     = y + height - 1;
+		radius_ = radius;
+		inknit_make_round_corner(insets_, radius);
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
+	std::int32_t x1_, y1_, x2_, y2_, radius_;
+	std::uint8_t insets_[255];
+};
+
+INKBM_ARGS(
+	fill_round_rect,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {x, y, width, height, radius}},
+
+		{"rr04_button", "48x16 button, radius 4",   TYPES { 13,  20,  48,  16,  4}},
+		{"rr08_card",   "100x60 card, radius 8",    TYPES { 14,  10, 100,  60,  8}},
+		{"rr20_pill",   "96x40 pill, radius 20",    TYPES { 16,  20,  96,  40, 20}},
+		{"rr12_full",   "whole image, radius 12",   TYPES {  0,   0, 128,  80, 12}},
+		{"rr10_clip",   "crosses every edge",       TYPES {-10, -10, 148, 100, 10}},
+		{"rr06_off",    "off-screen",               TYPES {-60,  10,  40,  30,  6}},
+	},
+	// clang-format on
+);
+
+// Fills a circle into every corner and the two rects between them that are not empty
+APPLY_FILL(composite) {
+	std::int32_t const r = radius_;
+	for (int i = 0; i < ITERATIONS; ++i) {
+		auto *const data = static_cast<uint32_t *>(image_.data());
+		INKNIT_INTERNAL_FUNC(fill_circle_with_clip, CURRENT_GROUP)(
+			data, image_.stride(), x1_ + r, y1_ + r, r, COLOR_WHITE, &clip_rect_
+		);
+		INKNIT_INTERNAL_FUNC(fill_circle_with_clip, CURRENT_GROUP)(
+			data, image_.stride(), x2_ - r, y1_ + r, r, COLOR_WHITE, &clip_rect_
+		);
+		INKNIT_INTERNAL_FUNC(fill_circle_with_clip, CURRENT_GROUP)(
+			data, image_.stride(), x1_ + r, y2_ - r, r, COLOR_WHITE, &clip_rect_
+		);
+		INKNIT_INTERNAL_FUNC(fill_circle_with_clip, CURRENT_GROUP)(
+			data, image_.stride(), x2_ - r, y2_ - r, r, COLOR_WHITE, &clip_rect_
+		);
+		if (x1_ + r <= x2_ - r) {
+			INKNIT_INTERNAL_FUNC(fill_rect_with_clip, CURRENT_GROUP)(
+				data, image_.stride(), x1_ + r, y1_, x2_ - r, y2_, COLOR_WHITE, &clip_rect_
+			);
+		}
+		if (y1_ + r <= y2_ - r) {
+			INKNIT_INTERNAL_FUNC(fill_rect_with_clip, CURRENT_GROUP)(
+				data, image_.stride(), x1_, y1_ + r, x2_, y2_ - r, COLOR_WHITE, &clip_rect_
+			);
+		}
+	}
+}
+
+// Builds the corner table on every call
+APPLY_FILL(spans) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		std::uint8_t insets[255];
+		inknit_make_round_corner(insets, radius_);
+		INKNIT_INTERNAL_FUNC(fill_round_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			radius_,
+			insets,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY_FILL(cached) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(fill_round_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			radius_,
+			insets_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	draw_round_rect,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {x, y, width, height, radius}},
+
+		{"rr04_button", "48x16 button, radius 4",   TYPES { 13,  20,  48,  16,  4}},
+		{"rr08_card",   "100x60 card, radius 8",    TYPES { 14,  10, 100,  60,  8}},
+		{"rr20_pill",   "96x40 pill, radius 20",    TYPES { 16,  20,  96,  40, 20}},
+		{"rr10_clip",   "crosses every edge",       TYPES {-10, -10, 148, 100, 10}},
+	},
+	// clang-format on
+);
+
+APPLY(spans_t1) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		std::uint8_t insets[255];
+		inknit_make_round_corner(insets, radius_);
+		INKNIT_INTERNAL_FUNC(draw_round_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			radius_,
+			1,
+			insets,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(cached_t1) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_round_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			radius_,
+			1,
+			insets_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(cached_t3) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_round_rect_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			radius_,
+			3,
+			insets_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
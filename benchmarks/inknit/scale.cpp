@@ -0,0 +1,109 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 2, be)
+#define TYPES         std::tuple<std::int32_t, std::int32_t, std::int32_t, std::int32_t>
+#define ITERATIONS    100
+
+#define APPLY(name) INKBM_FIXTURE_APPLY(name, blit_scaled, f_blit_scaled)
+
+// Scales the top-left corner of a 4-color checkerboard onto a 320x240 x2 framebuffer
+class f_blit_scaled: public fixture {
+public:
+	explicit f_blit_scaled() {
+		for (std::int32_t y = 0; y < src_.height(); ++y) {
+			for (std::int32_t x = 0; x < src_.width(); ++x) {
+				src_.draw_point(x, y, static_cast<color_t>((x / 4 + y / 4) & 3));
+			}
+		}
+	}
+
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [dw, dh, sw, sh] = *ptr;
+
+		drect_ = {0, 0, static_cast<std::int16_t>(dw), static_cast<std::int16_t>(dh)};
+		srect_ = {0, 0, static_cast<std::int16_t>(sw), static_cast<std::int16_t>(sh)};
+	}
+
+	void setup() noexcept override {
+		dst_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<320, 240, pixel_layout::x2, pixel_format::grayscale> src_;
+	fixed_image<320, 240, pixel_layout::x2, pixel_format::grayscale> dst_;
+
+	inknit_rect drect_, srect_;
+};
+
+INKBM_ARGS(
+	blit_scaled,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {dw, dh, sw, sh}},
+
+		{"x2_icon",   "16x16 icon to 32x32",       TYPES { 32,  32,  16,  16}},
+		{"x2_screen", "160x120 to 320x240",        TYPES {320, 240, 160, 120}},
+		{"x3_screen", "106x80 to 318x240",         TYPES {318, 240, 106,  80}},
+		{"x4_screen", "80x60 to 320x240",          TYPES {320, 240,  80,  60}},
+		{"r5_3",      "192x144 to 320x240 (5:3)",  TYPES {320, 240, 192, 144}},
+		{"half",      "320x240 to 160x120 (1:2)",  TYPES {160, 120, 320, 240}},
+	},
+	// clang-format on
+);
+
+// Maps every destination pixel on its own and reads and writes one pixel at a time
+APPLY(pixels) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(blit_scaled_pixels, CURRENT_GROUP)(&dst_, &drect_, &src_, &srect_);
+	}
+}
+
+// Source column map and row reuse, without the LUT
+APPLY(map) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(blit_scaled_map, CURRENT_GROUP)(&dst_, &drect_, &src_, &srect_);
+	}
+}
+
+APPLY(scaled) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		dst_.blit_scaled(
+			{drect_.left, drect_.top},
+			{drect_.right - drect_.left, drect_.bottom - drect_.top},
+			src_,
+			{srect_.left, srect_.top},
+			{srect_.right - srect_.left, srect_.bottom - srect_.top}
+		);
+	}
+}
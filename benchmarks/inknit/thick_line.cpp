@@ -0,0 +1,185 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "inknit.hpp"
+#include "inknit_internal.h"
+#include "utils/inkbm.hpp"
+#include "constants.hpp"
+
+using namespace inknit;
+using namespace inkbm;
+
+#define CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, le)
+#define TYPES         std::tuple<int32_t, int32_t, int32_t, int32_t, int32_t>
+#define POLYLINE      std::tuple<int32_t, inknit_line_join>
+#define ITERATIONS    DEFAULT_ITERATIONS
+
+#define APPLY(name)          INKBM_FIXTURE_APPLY(name, draw_thick_line, d_thick_line)
+#define APPLY_POLYLINE(name) INKBM_FIXTURE_APPLY(name, draw_thick_polyline, d_thick_polyline)
+
+class d_thick_line: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<TYPES>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [x1, y1, x2, y2, thickness] = *ptr;
+
+		x1_        = x1;
+		y1_        = y1;
+		x2_        = x2;
+		y2_        = y2;
+		thickness_ = thickness;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
+	std::int32_t x1_, y1_, x2_, y2_, thickness_;
+};
+
+// A zigzag chart line whose every vertex is a join
+class d_thick_polyline: public fixture {
+public:
+	void load(std::any const *data) noexcept override {
+		auto const *ptr = std::any_cast<POLYLINE>(data);
+		if (ptr == nullptr) {
+			INKBM_FATAL("Failed to unbind args.");
+		}
+
+		auto [thickness, join] = *ptr;
+
+		thickness_ = thickness;
+		join_      = join;
+	}
+
+	void setup() noexcept override {
+		image_.clear(COLOR_BLACK);
+	}
+
+protected:
+	fixed_image<128, 80, pixel_layout::x1lsb, pixel_format::grayscale> image_;
+
+	inknit_rect clip_rect_ {0, 0, 128, 80};
+
+	inknit_point points_[8] {
+		{8, 60},
+		{24, 20},
+		{40, 50},
+		{56, 14},
+		{72, 66},
+		{88, 30},
+		{104, 44},
+		{120, 12},
+	};
+
+	std::int32_t     thickness_;
+	inknit_line_join join_;
+};
+
+INKBM_ARGS(
+	draw_thick_line,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", TYPES {x1, y1, x2, y2, thickness}},
+
+		{"t3_shallow",  "3px, shallow",         TYPES {  4,  20, 123,  50,  3}},
+		{"t3_diagonal", "3px, diagonal",        TYPES { 20,   4,  95,  75,  3}},
+		{"t8_shallow",  "8px, shallow",         TYPES {  4,  20, 123,  50,  8}},
+		{"t8_diagonal", "8px, diagonal",        TYPES { 20,   4,  95,  75,  8}},
+		{"t8_vertical", "8px, vertical",        TYPES { 64,   4,  64,  75,  8}},
+		{"t16_short",   "16px, short",          TYPES { 50,  30,  70,  40, 16}},
+		{"t6_clip",     "6px, crosses the top", TYPES {-20,  60, 140, -30,  6}},
+	},
+	// clang-format on
+);
+
+// Draws `thickness` thin lines side by side, which is what callers did without a thick line
+APPLY(lines) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_thick_line_lines, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			thickness_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+APPLY(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_thick_line_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			x1_,
+			y1_,
+			x2_,
+			y2_,
+			thickness_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
+
+
+INKBM_ARGS(
+	draw_thick_polyline,
+	"Test Method",
+	// clang-format off
+	{
+		// {"short_name", "description", POLYLINE {thickness, join}},
+
+		{"p3_miter", "3px, miter joins", POLYLINE {3, INKNIT_JOIN_MITER}},
+		{"p3_round", "3px, round joins", POLYLINE {3, INKNIT_JOIN_ROUND}},
+		{"p3_bevel", "3px, bevel joins", POLYLINE {3, INKNIT_JOIN_BEVEL}},
+		{"p8_miter", "8px, miter joins", POLYLINE {8, INKNIT_JOIN_MITER}},
+		{"p8_round", "8px, round joins", POLYLINE {8, INKNIT_JOIN_ROUND}},
+		{"p8_bevel", "8px, bevel joins", POLYLINE {8, INKNIT_JOIN_BEVEL}},
+	},
+	// clang-format on
+);
+
+APPLY_POLYLINE(with_clip) {
+	for (int i = 0; i < ITERATIONS; ++i) {
+		INKNIT_INTERNAL_FUNC(draw_thick_polyline_with_clip, CURRENT_GROUP)(
+			static_cast<uint32_t *>(image_.data()),
+			image_.stride(),
+			points_,
+			8,
+			thickness_,
+			join_,
+			COLOR_WHITE,
+			&clip_rect_
+		);
+	}
+}
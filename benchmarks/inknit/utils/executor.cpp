@@ -90,5 +90,6 @@ statistics fixture_executor::execute(monitor *monitor, std::any const *data) con
 	fixture->teardown();
 
 	statistics stats {monitor->get()};
+	stats.work = fixture->work();
 	return stats;
 }
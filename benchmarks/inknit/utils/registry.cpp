@@ -155,6 +155,14 @@ void registry::print_stats(statistics const& stats, std::uint32_t offset) noexce
 		scale::format_string(stats.pct95).c_str(),
 		scale::format_string(stats.pct99).c_str()
 	);
+	if (stats.work.name != nullptr) {
+		printf(
+			"%s%s: %s\n",
+			spacing.c_str(),
+			stats.work.name,
+			with_commas(static_cast<int64_t>(stats.work.value)).c_str()
+		);
+	}
 
 #if _DEBUG
 	printf(
@@ -22,7 +22,7 @@
 #include "base.hpp"  // INKBM_NODISCARD
 
 #include <any>          // any
-#include <cstdint>      // uint32_t, int64_t
+#include <cstdint>      // uint32_t, int64_t, uint64_t
 #include <string_view>  // string_view
 #include <type_traits>  // is_arithmetic_v
 
@@ -39,6 +39,12 @@ struct minmax final {
 
 using stat_value = double;
 
+// Work done by a single execution, such as the number of pixels written
+struct counter final {
+	char const   *name {nullptr};
+	std::uint64_t value {0};
+};
+
 struct statistics final {
 	std::uint32_t count;
 
@@ -54,6 +60,8 @@ struct statistics final {
 	stat_value ufence;  // upper fence
 	stat_value pct95;   // 95th percentile
 	stat_value pct99;   // 99th percentile
+
+	counter work {};
 };
 
 struct fixture {
@@ -63,6 +71,11 @@ struct fixture {
 
 	virtual void load(INKBM_MAYBE_UNUSED std::any const *data) noexcept {}
 	virtual void execute() noexcept = 0;
+
+	INKBM_NODISCARD
+	virtual counter work() const noexcept {
+		return {};
+	}
 };
 
 class monitor {
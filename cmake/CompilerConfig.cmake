@@ -143,6 +143,7 @@ if(NOT DEFINED CMAKE_COMPILE_WARNING_AS_ERROR)
 endif()
 
 set(INKNIT_DISABLE_LUT       FALSE CACHE BOOL   "Disable internal LUT.")
+set(INKNIT_ENABLE_AVX2       FALSE CACHE BOOL   "Use AVX2 span kernels on x86_64 (SSE2 otherwise)")
 set(INKNIT_ENABLE_BENCHMARKS TRUE  CACHE BOOL   "Enable benchmarking utilities.")
 set(INKNIT_ENABLE_EXPORTS    FALSE CACHE BOOL   "Export c struct vtbl")
 set(INKNIT_ENABLE_OBJDUMP    FALSE CACHE BOOL   "Use objdump if specified project")
@@ -162,4 +163,10 @@ else()
 	message(FATAL_ERROR "CMAKE_SYSTEM_PROCESSOR is not allowed. Please use our custom build system.")
 endif()
 
+if(INKNIT_PROCESSOR STREQUAL "x86_64" OR INKNIT_PROCESSOR STREQUAL "aarch64")
+	set(INKNIT_ENABLE_WORD64 TRUE  CACHE BOOL "Build 64-bit word pixel layouts (*_64).")
+else()
+	set(INKNIT_ENABLE_WORD64 FALSE CACHE BOOL "Build 64-bit word pixel layouts (*_64).")
+endif()
+
 message(STATUS "Using toolchain file: ${CMAKE_TOOLCHAIN_FILE}")
@@ -21,6 +21,8 @@
 
 // -- MARK: headers
 #include "inknit/assertion.h"
+#include "inknit/corner.h"
+#include "inknit/pattern.h"
 #include "inknit/types.h"
 #include "inknit/prefix.h"
 
@@ -70,6 +72,39 @@ extern "C" {
 #include "inknit/proto.h.in"
 #undef INKNIT_CURRENT_LAYOUT
 
+#ifdef INKNIT_ENABLE_WORD64
+
+// Pixel Layout: x1_64 (64-bit width/align, 1-bpp, BE)
+#define INKNIT_CURRENT_LAYOUT x1_64
+#include "inknit/proto.h.in"
+#undef INKNIT_CURRENT_LAYOUT
+
+// Pixel Layout: x1lsb_64 (64-bit width/align, 1-bpp, LE)
+#define INKNIT_CURRENT_LAYOUT x1lsb_64
+#include "inknit/proto.h.in"
+#undef INKNIT_CURRENT_LAYOUT
+
+// Pixel Layout: x2_64 (64-bit width/align, 2-bpp, BE)
+#define INKNIT_CURRENT_LAYOUT x2_64
+#include "inknit/proto.h.in"
+#undef INKNIT_CURRENT_LAYOUT
+
+// Pixel Layout: x2lsb_64 (64-bit width/align, 2-bpp, LE)
+#define INKNIT_CURRENT_LAYOUT x2lsb_64
+#include "inknit/proto.h.in"
+#undef INKNIT_CURRENT_LAYOUT
+
+// Pixel Layout: x4_64 (64-bit width/align, 4-bpp, BE)
+#define INKNIT_CURRENT_LAYOUT x4_64
+#include "inknit/proto.h.in"
+#undef INKNIT_CURRENT_LAYOUT
+
+// Pixel Layout: x4lsb_64 (64-bit width/align, 4-bpp, LE)
+#define INKNIT_CURRENT_LAYOUT x4lsb_64
+#include "inknit/proto.h.in"
+#undef INKNIT_CURRENT_LAYOUT
+#endif
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -0,0 +1,37 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>  // int32_t, uint8_t
+#include "macro.h"   // INKNIT_EXPORT, INKNIT_NONNULL
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Writes the corner table of a round rect into insets[0, radius): how far row i, counted from the
+// top or bottom edge, starts inside the left and right edges. The corners are the quadrants of
+// inknit_fill_circle, so the table does not depend on the pixel layout and round rects with the
+// same radius can share it. `radius` is at most 255.
+void INKNIT_EXPORT inknit_make_round_corner(uint8_t *insets, int32_t radius) INKNIT_NONNULL(1);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
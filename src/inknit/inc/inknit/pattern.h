@@ -0,0 +1,35 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdint.h>  // int32_t, uint8_t
+#include "macro.h"   // INKNIT_EXPORT, INKNIT_NONNULL
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Writes the 8x8 pattern of inknit_fill_rect_pattern that sets `level` of its 64 pixels, in the
+// order of the Bayer matrix so that every level spreads them evenly. A level of 4k sets the same
+// pixels as k of the 4x4 Bayer matrix repeated. `level` is at most 64.
+void INKNIT_EXPORT inknit_make_dither_pattern(uint8_t *pattern, int32_t level) INKNIT_NONNULL(1);
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
@@ -0,0 +1,141 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Span kernels operate on whole words of packed pixels and do not depend on the pixel layout.
+// The fill pattern is a single byte because every solid color fills each byte identically.
+// `bytes` is always a multiple of 4 (the smallest word size).
+//
+// Stitch kernels copy a bit-shifted source span: dst[i] takes the bits of src[i] and src[i + 1]
+// starting at bit `shift` (0-7) in pixel order. Pixel order only depends on whether the layout is
+// MSB- or LSB-first, since word byte swapping already makes the memory image a byte stream.
+// `bytes` must be at least INKNIT_SPAN_MIN_BYTES, and src[bytes] is read as well.
+
+#if defined(INKNIT_ENABLE_SPAN_SSE2) || defined(INKNIT_ENABLE_SPAN_AVX2) \
+	|| defined(INKNIT_ENABLE_SPAN_NEON)
+#define INKNIT_ENABLE_SPAN_SIMD
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_NEON
+#define INKNIT_ENABLE_SPAN_STITCH
+#endif
+
+// Shorter spans stay in the caller's inline word loop; the call costs more than it saves.
+#define INKNIT_SPAN_MIN_BYTES 16
+
+// Swap-order kernels reverse the order of the `bpp`-bit pixels (1, 2 or 4) inside every byte, which
+// converts between a layout and its LSB twin. `dst` may equal `src` for in-place conversion.
+static inline uint32_t _inknit_span_swap_order_u32(uint32_t value, uint32_t bpp) {
+	// Swap nibbles, then bit pairs within nibbles, then bits within pairs
+	value = ((value >> 4) & UINT32_C(0x0F0F0F0F)) | ((value & UINT32_C(0x0F0F0F0F)) << 4);
+	if (bpp <= 2) {
+		value = ((value >> 2) & UINT32_C(0x33333333)) | ((value & UINT32_C(0x33333333)) << 2);
+	}
+	if (bpp <= 1) {
+		value = ((value >> 1) & UINT32_C(0x55555555)) | ((value & UINT32_C(0x55555555)) << 1);
+	}
+	return value;
+}
+
+#ifdef INKNIT_ENABLE_SPAN_SSE2
+void INKNIT_EXPORT _inknit_span_fill_sse2(void *data, uint8_t pattern, uint32_t bytes)
+	INKNIT_NONNULL(1);
+void INKNIT_EXPORT
+_inknit_span_copy_sse2(void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT
+_inknit_span_swap_order_sse2(void *dst, const void *src, uint32_t bpp, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_AVX2
+void INKNIT_EXPORT _inknit_span_fill_avx2(void *data, uint8_t pattern, uint32_t bytes)
+	INKNIT_NONNULL(1);
+void INKNIT_EXPORT
+_inknit_span_copy_avx2(void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT
+_inknit_span_swap_order_avx2(void *dst, const void *src, uint32_t bpp, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_NEON
+void INKNIT_EXPORT _inknit_span_fill_neon(void *data, uint8_t pattern, uint32_t bytes)
+	INKNIT_NONNULL(1);
+void INKNIT_EXPORT
+_inknit_span_copy_neon(void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT
+_inknit_span_swap_order_neon(void *dst, const void *src, uint32_t bpp, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT _inknit_span_stitch_msb_neon(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT _inknit_span_stitch_lsb_neon(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) INKNIT_NONNULL(1, 2);
+#endif
+
+#if defined(INKNIT_ENABLE_BENCHMARKS) && defined(INKNIT_ENABLE_SPAN_SIMD)
+void INKNIT_EXPORT _inknit_span_fill_scalar(void *data, uint8_t pattern, uint32_t bytes)
+	INKNIT_NONNULL(1);
+void INKNIT_EXPORT
+_inknit_span_copy_scalar(void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT
+_inknit_span_swap_order_scalar(void *dst, const void *src, uint32_t bpp, uint32_t bytes)
+	INKNIT_NONNULL(1, 2);
+#endif
+
+#if defined(INKNIT_ENABLE_BENCHMARKS) && defined(INKNIT_ENABLE_SPAN_STITCH)
+void INKNIT_EXPORT _inknit_span_stitch_msb_scalar(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) INKNIT_NONNULL(1, 2);
+void INKNIT_EXPORT _inknit_span_stitch_lsb_scalar(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) INKNIT_NONNULL(1, 2);
+#endif
+
+// Kernel selected at build time
+#if defined(INKNIT_ENABLE_SPAN_AVX2)
+#define _inknit_span_fill       _inknit_span_fill_avx2
+#define _inknit_span_copy       _inknit_span_copy_avx2
+#define _inknit_span_swap_order _inknit_span_swap_order_avx2
+#elif defined(INKNIT_ENABLE_SPAN_SSE2)
+#define _inknit_span_fill       _inknit_span_fill_sse2
+#define _inknit_span_copy       _inknit_span_copy_sse2
+#define _inknit_span_swap_order _inknit_span_swap_order_sse2
+#elif defined(INKNIT_ENABLE_SPAN_NEON)
+#define _inknit_span_fill       _inknit_span_fill_neon
+#define _inknit_span_copy       _inknit_span_copy_neon
+#define _inknit_span_swap_order _inknit_span_swap_order_neon
+#define _inknit_span_stitch_msb _inknit_span_stitch_msb_neon
+#define _inknit_span_stitch_lsb _inknit_span_stitch_lsb_neon
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" { */
+#endif
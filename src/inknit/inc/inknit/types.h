@@ -100,6 +100,26 @@ enum inknit_alignment {
 	INKNIT_ALIGN1024,
 };
 
+enum inknit_rop {
+	INKNIT_ROP_COPY,    ///< dst = src
+	INKNIT_ROP_AND,     ///< dst = dst & src
+	INKNIT_ROP_OR,      ///< dst = dst | src
+	INKNIT_ROP_XOR,     ///< dst = dst ^ src
+	INKNIT_ROP_ANDNOT,  ///< dst = dst & ~src
+	INKNIT_ROP_KEY,     ///< dst = src, except where src == key (transparent)
+};
+
+enum inknit_fill_rule {
+	INKNIT_FILL_EVEN_ODD,  ///< Inside where the outline is crossed an odd number of times
+	INKNIT_FILL_NONZERO,   ///< Inside where the outline winds around the pixel at least once
+};
+
+enum inknit_line_join {
+	INKNIT_JOIN_MITER,  ///< Outer edges extended until they meet, beveled past twice the thickness
+	INKNIT_JOIN_ROUND,  ///< A disc as wide as the line
+	INKNIT_JOIN_BEVEL,  ///< Outer corners joined straight
+};
+
 struct inknit_rect {
 	int16_t left;
 	int16_t top;
@@ -107,6 +127,36 @@ struct inknit_rect {
 	int16_t bottom;
 };
 
+struct inknit_point {
+	int16_t x;
+	int16_t y;
+};
+
+struct inknit_segment {
+	struct inknit_point start;
+	struct inknit_point end;
+};
+
+// Scratch storage for inknit_fill_polygon, one entry per vertex. The fields are private.
+struct inknit_polygon_edge {
+	int32_t x;
+	int32_t step;
+	int16_t rem;
+	int16_t step_rem;
+	int16_t den;
+	int16_t top;
+	int16_t bottom;
+	int16_t winding;
+};
+
+// Scratch storage for inknit_flood_fill, one entry per pending span. The fields are private.
+struct inknit_flood_span {
+	int16_t x1;
+	int16_t x2;
+	int16_t y;
+	int16_t dy;
+};
+
 struct inknit_image {
 	const enum inknit_pixellayout pixel_layout : 8;
 	const enum inknit_pixelformat pixel_format : 4;
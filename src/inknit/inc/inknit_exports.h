@@ -46,12 +46,68 @@ struct inknit_exports {
 		inknit_uint_t                              height
 	) INKNIT_NONNULL(1, 4);
 
+	void (*const blit_rop)(
+		struct inknit_image *INKNIT_RESTRICT       dst,
+		inknit_uint_t                              dx,
+		inknit_uint_t                              dy,
+		const struct inknit_image *INKNIT_RESTRICT src,
+		inknit_uint_t                              sx,
+		inknit_uint_t                              sy,
+		inknit_uint_t                              width,
+		inknit_uint_t                              height,
+		enum inknit_rop                            rop,
+		inknit_color_t                             key
+	) INKNIT_NONNULL(1, 4);
+
+	void (*const blit_convert)(
+		struct inknit_image *INKNIT_RESTRICT       dst,
+		inknit_uint_t                              dx,
+		inknit_uint_t                              dy,
+		const struct inknit_image *INKNIT_RESTRICT src,
+		inknit_uint_t                              sx,
+		inknit_uint_t                              sy,
+		inknit_uint_t                              width,
+		inknit_uint_t                              height,
+		const inknit_color_t                      *palette
+	) INKNIT_NONNULL(1, 4);
+
+	void (*const blit_scaled)(
+		struct inknit_image *INKNIT_RESTRICT       dst,
+		const struct inknit_rect *INKNIT_RESTRICT  drect,
+		const struct inknit_image *INKNIT_RESTRICT src,
+		const struct inknit_rect *INKNIT_RESTRICT  srect
+	) INKNIT_NONNULL(1, 2, 3, 4);
+
+	void (*const scroll)(
+		struct inknit_image *INKNIT_RESTRICT      image,
+		const struct inknit_rect *INKNIT_RESTRICT rect,
+		int32_t                                   dx,
+		int32_t                                   dy,
+		inknit_color_t                            fill_color
+	) INKNIT_NONNULL(1, 2);
+
+	void (*const convert_order)(
+		struct inknit_image *INKNIT_RESTRICT dst, const struct inknit_image *INKNIT_RESTRICT src
+	) INKNIT_NONNULL(1, 2);
+
+	void (*const convert_order_in_place)(struct inknit_image *image) INKNIT_NONNULL(1);
+
 	void (*const clear)(struct inknit_image *image, inknit_color_t color) INKNIT_NONNULL(1);
 
 	void (*const fill_circle)(
 		struct inknit_image *image, int32_t cx, int32_t cy, int32_t radius, inknit_color_t color
 	) INKNIT_NONNULL(1);
 
+	void (*const fill_circle_pattern)(
+		struct inknit_image *image,
+		int32_t              cx,
+		int32_t              cy,
+		int32_t              radius,
+		const uint8_t       *pattern,
+		inknit_color_t       color,
+		inknit_color_t       background
+	) INKNIT_NONNULL(1, 5);
+
 	void (*const fill_ellipse)(
 		struct inknit_image *image,
 		int32_t              cx,
@@ -61,6 +117,15 @@ struct inknit_exports {
 		inknit_color_t       color
 	) INKNIT_NONNULL(1);
 
+	void (*const fill_polygon)(
+		struct inknit_image        *image,
+		const struct inknit_point  *points,
+		uint32_t                    count,
+		inknit_color_t              color,
+		enum inknit_fill_rule       rule,
+		struct inknit_polygon_edge *edges
+	) INKNIT_NONNULL(1);
+
 	void (*const fill_rect)(
 		struct inknit_image *image,
 		int32_t              x,
@@ -79,6 +144,79 @@ struct inknit_exports {
 		inknit_color_t       color
 	) INKNIT_NONNULL(1);
 
+	void (*const fill_rect_pattern)(
+		struct inknit_image *image,
+		int32_t              x,
+		int32_t              y,
+		int32_t              width,
+		int32_t              height,
+		const uint8_t       *pattern,
+		inknit_color_t       color,
+		inknit_color_t       background
+	) INKNIT_NONNULL(1, 6);
+
+	void (*const fill_ring)(
+		struct inknit_image *image,
+		int32_t              cx,
+		int32_t              cy,
+		int32_t              radius,
+		int32_t              thickness,
+		int32_t              start,
+		int32_t              end,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
+	void (*const fill_round_rect)(
+		struct inknit_image *image,
+		int32_t              x,
+		int32_t              y,
+		int32_t              width,
+		int32_t              height,
+		int32_t              radius,
+		const uint8_t       *insets,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
+	void (*const fill_sector)(
+		struct inknit_image *image,
+		int32_t              cx,
+		int32_t              cy,
+		int32_t              radius,
+		int32_t              start,
+		int32_t              end,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
+	void (*const fill_triangle)(
+		struct inknit_image *image,
+		int32_t              x1,
+		int32_t              y1,
+		int32_t              x2,
+		int32_t              y2,
+		int32_t              x3,
+		int32_t              y3,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
+	bool (*const flood_fill)(
+		struct inknit_image      *image,
+		int32_t                   x,
+		int32_t                   y,
+		inknit_color_t            color,
+		struct inknit_flood_span *scratch,
+		uint32_t                  scratch_size
+	) INKNIT_NONNULL(1);
+
+	void (*const draw_arc)(
+		struct inknit_image *image,
+		int32_t              cx,
+		int32_t              cy,
+		int32_t              radius,
+		int32_t              start,
+		int32_t              end,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
 	void (*const draw_circle)(
 		struct inknit_image *image, int32_t cx, int32_t cy, int32_t radius, inknit_color_t color
 	) INKNIT_NONNULL(1);
@@ -109,6 +247,20 @@ struct inknit_exports {
 		inknit_color_t       color
 	) INKNIT_NONNULL(1);
 
+	void (*const draw_lines)(
+		struct inknit_image         *image,
+		const struct inknit_segment *segments,
+		uint32_t                     count,
+		inknit_color_t               color
+	) INKNIT_NONNULL(1);
+
+	void (*const draw_polyline)(
+		struct inknit_image       *image,
+		const struct inknit_point *points,
+		uint32_t                   count,
+		inknit_color_t             color
+	) INKNIT_NONNULL(1);
+
 	void (*const draw_rect)(
 		struct inknit_image *image,
 		int32_t              x,
@@ -127,6 +279,37 @@ struct inknit_exports {
 		inknit_color_t       color
 	) INKNIT_NONNULL(1);
 
+	void (*const draw_round_rect)(
+		struct inknit_image *image,
+		int32_t              x,
+		int32_t              y,
+		int32_t              width,
+		int32_t              height,
+		int32_t              radius,
+		int32_t              thickness,
+		const uint8_t       *insets,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
+	void (*const draw_thick_line)(
+		struct inknit_image *image,
+		int32_t              x1,
+		int32_t              y1,
+		int32_t              x2,
+		int32_t              y2,
+		int32_t              thickness,
+		inknit_color_t       color
+	) INKNIT_NONNULL(1);
+
+	void (*const draw_thick_polyline)(
+		struct inknit_image       *image,
+		const struct inknit_point *points,
+		uint32_t                   count,
+		int32_t                    thickness,
+		enum inknit_line_join      join,
+		inknit_color_t             color
+	) INKNIT_NONNULL(1);
+
 	void (*const draw_vline)(
 		struct inknit_image *image, int32_t x, int32_t y1, int32_t y2, inknit_color_t color
 	) INKNIT_NONNULL(1);
@@ -143,6 +326,14 @@ extern const struct inknit_exports x2;
 extern const struct inknit_exports x2lsb;
 extern const struct inknit_exports x4;
 extern const struct inknit_exports x4lsb;
+#ifdef INKNIT_ENABLE_WORD64
+extern const struct inknit_exports x1_64;
+extern const struct inknit_exports x1lsb_64;
+extern const struct inknit_exports x2_64;
+extern const struct inknit_exports x2lsb_64;
+extern const struct inknit_exports x4_64;
+extern const struct inknit_exports x4lsb_64;
+#endif
 
 #ifdef __cplusplus
 } /* extern "C" { */
@@ -21,6 +21,7 @@
 
 #include "inknit/types.h"
 #include "inknit/prefix.h"
+#include "inknit/span_internal.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,33 +29,90 @@ extern "C" {
 
 // Pixel Layout: x1 (32-bit width/align, 1-bpp, BE)
 #define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, be)
+#define INKNIT_CURRENT_WORD  uint32_t
 #include "inknit/proto_internal.h.in"
 #undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
 
 // Pixel Layout: x1lsb (32-bit width/align, 1-bpp, LE)
 #define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 1, le)
+#define INKNIT_CURRENT_WORD  uint32_t
 #include "inknit/proto_internal.h.in"
 #undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
 
 // Pixel Layout: x2 (32-bit width/align, 2-bpp, BE)
 #define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 2, be)
+#define INKNIT_CURRENT_WORD  uint32_t
 #include "inknit/proto_internal.h.in"
 #undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
 
 // Pixel Layout: x2lsb (32-bit width/align, 2-bpp, LE)
 #define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 2, le)
+#define INKNIT_CURRENT_WORD  uint32_t
 #include "inknit/proto_internal.h.in"
 #undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
 
 // Pixel Layout: x4 (32-bit width/align, 4-bpp, BE)
 #define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 4, be)
+#define INKNIT_CURRENT_WORD  uint32_t
 #include "inknit/proto_internal.h.in"
 #undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
 
 // Pixel Layout: x4lsb (32-bit width/align, 4-bpp, LE)
 #define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(32, 4, le)
+#define INKNIT_CURRENT_WORD  uint32_t
 #include "inknit/proto_internal.h.in"
 #undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+
+#ifdef INKNIT_ENABLE_WORD64
+
+// Pixel Layout: x1_64 (64-bit width/align, 1-bpp, BE)
+#define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(64, 1, be)
+#define INKNIT_CURRENT_WORD  uint64_t
+#include "inknit/proto_internal.h.in"
+#undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+
+// Pixel Layout: x1lsb_64 (64-bit width/align, 1-bpp, LE)
+#define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(64, 1, le)
+#define INKNIT_CURRENT_WORD  uint64_t
+#include "inknit/proto_internal.h.in"
+#undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+
+// Pixel Layout: x2_64 (64-bit width/align, 2-bpp, BE)
+#define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(64, 2, be)
+#define INKNIT_CURRENT_WORD  uint64_t
+#include "inknit/proto_internal.h.in"
+#undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+
+// Pixel Layout: x2lsb_64 (64-bit width/align, 2-bpp, LE)
+#define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(64, 2, le)
+#define INKNIT_CURRENT_WORD  uint64_t
+#include "inknit/proto_internal.h.in"
+#undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+
+// Pixel Layout: x4_64 (64-bit width/align, 4-bpp, BE)
+#define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(64, 4, be)
+#define INKNIT_CURRENT_WORD  uint64_t
+#include "inknit/proto_internal.h.in"
+#undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+
+// Pixel Layout: x4lsb_64 (64-bit width/align, 4-bpp, LE)
+#define INKNIT_CURRENT_GROUP INKNIT_INTERNAL_GROUP(64, 4, le)
+#define INKNIT_CURRENT_WORD  uint64_t
+#include "inknit/proto_internal.h.in"
+#undef INKNIT_CURRENT_GROUP
+#undef INKNIT_CURRENT_WORD
+#endif
 
 #ifdef __cplusplus
 } /* extern "C" { */
@@ -85,11 +85,80 @@
 
 #if defined(_MSC_VER)
 #define INKNIT_BSWAP32(_x) _byteswap_ulong(_x)
+#define INKNIT_BSWAP64(_x) _byteswap_uint64(_x)
 #elif __has_builtin(__builtin_bswap32)
 #define INKNIT_BSWAP32(_x) __builtin_bswap32(_x)
+#define INKNIT_BSWAP64(_x) __builtin_bswap64(_x)
 #else
 #include <byteswap.h>
 #define INKNIT_BSWAP32(_x) bswap_32(_x)
+#define INKNIT_BSWAP64(_x) bswap_64(_x)
+#endif
+
+// Leading and trailing zero counts. The result is undefined when the argument is zero.
+#if defined(_MSC_VER)
+#include <intrin.h>
+static __forceinline int _inknit_clz32(unsigned long x) {
+	unsigned long index;
+	_BitScanReverse(&index, x);
+	return 31 ^ (int)index;
+}
+static __forceinline int _inknit_ctz32(unsigned long x) {
+	unsigned long index;
+	_BitScanForward(&index, x);
+	return (int)index;
+}
+#if defined(_M_X64) || defined(_M_ARM64)
+static __forceinline int _inknit_clz64(unsigned long long x) {
+	unsigned long index;
+	_BitScanReverse64(&index, x);
+	return 63 ^ (int)index;
+}
+static __forceinline int _inknit_ctz64(unsigned long long x) {
+	unsigned long index;
+	_BitScanForward64(&index, x);
+	return (int)index;
+}
+#else
+static __forceinline int _inknit_clz64(unsigned long long x) {
+	const unsigned long high = (unsigned long)(x >> 32);
+	return high != 0 ? _inknit_clz32(high) : 32 + _inknit_clz32((unsigned long)x);
+}
+static __forceinline int _inknit_ctz64(unsigned long long x) {
+	const unsigned long low = (unsigned long)x;
+	return low != 0 ? _inknit_ctz32(low) : 32 + _inknit_ctz32((unsigned long)(x >> 32));
+}
+#endif
+#define INKNIT_CLZ32(_x) _inknit_clz32(_x)
+#define INKNIT_CLZ64(_x) _inknit_clz64(_x)
+#define INKNIT_CTZ32(_x) _inknit_ctz32(_x)
+#define INKNIT_CTZ64(_x) _inknit_ctz64(_x)
+#elif __has_builtin(__builtin_clz)
+#define INKNIT_CLZ32(_x) __builtin_clz(_x)
+#define INKNIT_CLZ64(_x) __builtin_clzll(_x)
+#define INKNIT_CTZ32(_x) __builtin_ctz(_x)
+#define INKNIT_CTZ64(_x) __builtin_ctzll(_x)
+#else
+static inline int _inknit_clz64(uint64_t x) {
+	int count = 0;
+	while ((x & UINT64_C(0x8000000000000000)) == 0) {
+		x <<= 1;
+		++count;
+	}
+	return count;
+}
+static inline int _inknit_ctz64(uint64_t x) {
+	int count = 0;
+	while ((x & 1) == 0) {
+		x >>= 1;
+		++count;
+	}
+	return count;
+}
+#define INKNIT_CLZ32(_x) (_inknit_clz64((uint64_t)(_x) << 32))
+#define INKNIT_CLZ64(_x) _inknit_clz64(_x)
+#define INKNIT_CTZ32(_x) _inknit_ctz64(_x)
+#define INKNIT_CTZ64(_x) _inknit_ctz64(_x)
 #endif
 
 #if defined(__GNUC__) && __GNUC__ >= 7
@@ -141,6 +210,9 @@
 // -- MARK: internal constants
 #define INKNIT_CIRCLE_MAX  4095   // 2^12 - 1
 #define INKNIT_ELLIPSE_MAX 1023   // 2^10 - 1
+#define INKNIT_CORNER_MAX  255    // 2^8 - 1
+#define INKNIT_STROKE_MAX  255    // 2^8 - 1
+#define INKNIT_DITHER_MAX  64     // 2^6
 #define INKNIT_X_MIN       -2048  // -2^11
 #define INKNIT_X_MAX       2047   // 2^11 - 1
 #define INKNIT_Y_MIN       -2048  // -2^11
@@ -24,6 +24,7 @@
 #define MSG_ERROR_IMAGE_ALIGN  "->alignment < "
 #define MSG_ERROR_IMAGE_WIDTH  "->width > 2^11 - 1"
 #define MSG_ERROR_IMAGE_HEIGHT "->height > 2^11 - 1"
+#define MSG_ERROR_IMAGE_SIZE   "->width/height != dst->width/height"
 
 #define MSG_CX_LESS_THAN_MIN_VALUE    "ERROR: cx < -2^11"
 #define MSG_CX_GREATER_THAN_MAX_VALUE "ERROR: cx > 2^11 - 1"
@@ -43,6 +44,7 @@
 
 #define MSG_RADIUS_LESS_THAN_ZERO         "ERROR: radius < 0"
 #define MSG_RADIUS_GREATER_THAN_MAX_VALUE "ERROR: radius > 2^12 - 1"
+#define MSG_RADIUS_GREATER_THAN_CORNER    "ERROR: radius > 2^8 - 1"
 
 #define MSG_RX_LESS_THAN_ZERO         "ERROR: rx < 0"
 #define MSG_RX_GREATER_THAN_MAX_VALUE "ERROR: rx > 2^10 - 1"
@@ -52,11 +54,16 @@
 #define MSG_SX_GREATER_THAN_MAX_VALUE "ERROR: sx > 2^11 - 1"
 #define MSG_SY_GREATER_THAN_MAX_VALUE "ERROR: sy > 2^11 - 1"
 
+#define MSG_SRECT_OUTSIDE_SRC "ERROR: srect is outside src"
+
 #define MSG_WIDTH_LESS_THAN_ZERO          "ERROR: width < 0"
 #define MSG_WIDTH_GREATER_THAN_MAX_VALUE  "ERROR: width > 2^11 - 1"
 #define MSG_HEIGHT_LESS_THAN_ZERO         "ERROR: height < 0"
 #define MSG_HEIGHT_GREATER_THAN_MAX_VALUE "ERROR: height > 2^11 - 1"
 
+#define MSG_LEVEL_LESS_THAN_ZERO      "ERROR: level < 0"
+#define MSG_LEVEL_GREATER_THAN_DITHER "ERROR: level > 2^6"
+
 #define MSG_X_LESS_THAN_MIN_VALUE     "ERROR: x < -2^11"
 #define MSG_X_LESS_THAN_ZERO          "ERROR: x < 0"
 #define MSG_X_GREATER_THAN_MAX_VALUE  "ERROR: x > 2^11 - 1"
@@ -75,4 +82,9 @@
 #define MSG_Y1_GREATER_THAN_Y2        "ERROR: y1 > y2"
 #define MSG_Y2_GREATER_THAN_MAX_VALUE "ERROR: y2 > 2^11 - 1"
 
+#define MSG_COUNT_GREATER_THAN_FOUR "ERROR: count > 4"
+
+#define MSG_THICKNESS_LESS_THAN_ONE       "ERROR: thickness < 1"
+#define MSG_THICKNESS_GREATER_THAN_STROKE "ERROR: thickness > 2^8 - 1"
+
 #define MSG_COLOR_GREATER_THAN_MAX_VALUE "ERROR: color > 2^bpp - 1"
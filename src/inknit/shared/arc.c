@@ -0,0 +1,135 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "arc.h"
+
+#include "../inknit_impl.h"
+
+// round(tan(d) * INKNIT_ARC_UNIT) for d = 0 to 45 degrees
+static const uint16_t _inknit_arc_slopes[46] = {
+	0,    71,   143,  215,  286,  358,  431,  503,  576,  649,  722,  796,  871,  946,  1021, 1098,
+	1175, 1252, 1331, 1410, 1491, 1572, 1655, 1739, 1824, 1910, 1998, 2087, 2178, 2270, 2365, 2461,
+	2559, 2660, 2763, 2868, 2976, 3087, 3200, 3317, 3437, 3561, 3688, 3820, 3955, 4096,
+};
+
+// Returns `angle` in [0, 360)
+static inline int32_t _inknit_normalize_angle(int32_t angle) {
+	angle %= 360;
+	return angle < 0 ? angle + 360 : angle;
+}
+
+// Sets the direction of `angle` in [0, 360): the slope is looked up within the octant, then
+// turned a quarter at a time. A quarter turn clockwise maps (x, y) to (-y, x).
+static void _inknit_get_arc_direction(int32_t angle, int32_t *x, int32_t *y) {
+	const int32_t within = angle % 90;
+
+	int32_t dx, dy;
+	if (within <= 45) {
+		dx = INKNIT_ARC_UNIT;
+		dy = _inknit_arc_slopes[within];
+	} else {
+		dx = _inknit_arc_slopes[90 - within];
+		dy = INKNIT_ARC_UNIT;
+	}
+
+	for (int32_t quarter = angle / 90; quarter > 0; --quarter) {
+		const int32_t t = dx;
+		dx = -dy;
+		dy = t;
+	}
+	*x = dx;
+	*y = dy;
+}
+
+void _inknit_make_arc_wedge(struct inknit_arc_wedge *wedge, int32_t start, int32_t end) {
+	const int32_t sweep = end - start;
+
+	wedge->start = _inknit_normalize_angle(start);
+	wedge->sweep = sweep >= 360 ? 360 : _inknit_normalize_angle(sweep);
+
+	const int32_t stop = _inknit_normalize_angle(wedge->start + wedge->sweep);
+	_inknit_get_arc_direction(wedge->start, &wedge->start_x, &wedge->start_y);
+	_inknit_get_arc_direction(stop, &wedge->end_x, &wedge->end_y);
+}
+
+// Octant o spans the angles [45 * o, 45 * o + 45]. Sets bit o of `*drawn` when the wedge reaches
+// into it and of `*cut` when a ray lies inside, so its pixels have to be tested one by one. An
+// octant the wedge only touches at one end adds nothing when that end is an axis, whose pixels the
+// next octant holds as well, or when it is one of the vertical octants 0, 3, 4 and 7, which leave
+// the pixels on the diagonals to the horizontal ones.
+void _inknit_get_arc_octants(const struct inknit_arc_wedge *wedge, uint32_t *drawn, uint32_t *cut) {
+	if (wedge->sweep >= 360) {
+		*drawn = 0xFF;
+		*cut   = 0;
+		return;
+	}
+
+	*drawn = 0;
+	*cut   = 0;
+	for (int32_t o = 0; o < 8; ++o) {
+		const uint32_t bit   = UINT32_C(1) << o;
+		const int32_t  angle = 45 * o;
+		const int32_t  from  = _inknit_normalize_angle(angle - wedge->start);
+		if (from + 45 <= wedge->sweep) {
+			*drawn |= bit;
+		} else if (from < wedge->sweep || 315 < from) {
+			*drawn |= bit;
+			*cut   |= bit;
+		} else if ((o + 1) & 2) {
+			const bool at_start = from == wedge->sweep && angle % 90 != 0;
+			const bool at_end   = from == 315 && (angle + 45) % 90 != 0;
+			if (at_start || at_end) {
+				*drawn |= bit;
+				*cut   |= bit;
+			}
+		}
+	}
+}
+
+// Sets the rows [*top, *bottom] that the wedge can reach between the circles of radius `hole` and
+// `radius`, relative to the center. Unless the top or bottom of the circle is inside it, a wedge
+// spans from the ends of its rays on one circle to those on the other. A direction is up to sqrt(2)
+// times longer than its longer component, so the rows of the outer ends are taken as they are and
+// those of the inner ends are brought closer to the center by 181/256. Both get a margin for the
+// rounding and the half pixel of the outline; the center row is exact.
+void _inknit_get_arc_rows(
+	const struct inknit_arc_wedge *wedge,
+	int32_t                        radius,
+	int32_t                        hole,
+	int32_t                       *top,
+	int32_t                       *bottom
+) {
+	const int32_t outer_start = radius * wedge->start_y / INKNIT_ARC_UNIT;
+	const int32_t outer_end   = radius * wedge->end_y / INKNIT_ARC_UNIT;
+	const int32_t inner_start = hole * wedge->start_y / INKNIT_ARC_UNIT * 181 / 256;
+	const int32_t inner_end   = hole * wedge->end_y / INKNIT_ARC_UNIT * 181 / 256;
+
+	int32_t low  = outer_start < outer_end ? outer_start : outer_end;
+	int32_t high = outer_start < outer_end ? outer_end : outer_start;
+	low          = inner_start < low ? inner_start : low;
+	low          = inner_end < low ? inner_end : low;
+	high         = high < inner_start ? inner_start : high;
+	high         = high < inner_end ? inner_end : high;
+	low          = low < 0 || hole > 0 ? low - 2 : low;
+	high         = high > 0 || hole > 0 ? high + 2 : high;
+
+	*top    = _inknit_arc_wedge_has(wedge, 270) || low < -radius ? -radius : low;
+	*bottom = _inknit_arc_wedge_has(wedge, 90) || radius < high ? radius : high;
+}
@@ -0,0 +1,210 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../inc/inknit/types.h"
+#include "../inc/inknit/macro.h"
+
+// Angles are in degrees, clockwise from the positive x axis since y grows downwards. A direction
+// is kept as a slope, a vector whose longer component is INKNIT_ARC_UNIT, so nothing needs sin,
+// cos or floating point. Pixels are tested against the rays through the center with cross
+// products, and the pixels of a row on one side of a ray are a half-line whose end steps by a
+// fixed amount from row to row.
+
+#define INKNIT_ARC_UNIT      4096       // 2^12
+#define INKNIT_ARC_UNBOUNDED 0x100000  // 2^20, beyond any coordinate
+
+// The angles from `start` clockwise to `end`
+struct inknit_arc_wedge {
+	int32_t start;  // [0, 360)
+	int32_t sweep;  // [0, 360], 360 for the whole circle
+	int32_t start_x;
+	int32_t start_y;
+	int32_t end_x;
+	int32_t end_y;
+};
+
+// The pixels of a row on one side of a ray, `a * x <= b * dy + c`. `x` is floor((b * dy + c) / den)
+// with den = |a| and is stepped like a polygon edge. `side` tells which half-line it bounds:
+// 1 for x <= this->x, -1 for x >= -this->x, and 0 when the ray is horizontal, where a row is
+// either all in (this->x >= 0) or all out.
+struct inknit_arc_bound {
+	int32_t x;
+	int32_t rem;
+	int32_t den;
+	int32_t step;
+	int32_t step_rem;
+	int32_t side;
+};
+
+// Walks the rows of a filled circle in order, keeping the half-width of the last one
+struct inknit_circle_rows {
+	int32_t radius;
+	int32_t radius_sq;
+	int32_t dx;
+};
+
+// Returns whether `angle` in [0, 360) lies in the wedge
+static inline bool _inknit_arc_wedge_has(const struct inknit_arc_wedge *wedge, int32_t angle) {
+	int32_t offset = angle - wedge->start;
+	offset        += offset < 0 ? 360 : 0;
+	return offset <= wedge->sweep;
+}
+
+// Returns whether pixel (dx, dy) from the center lies in the wedge. Up to a half turn both rays
+// must have it on their inner side; past that it must not be strictly outside both.
+static inline bool _inknit_arc_wedge_contains(
+	const struct inknit_arc_wedge *wedge, int32_t dx, int32_t dy
+) {
+	if (wedge->sweep >= 360) {
+		return true;
+	}
+	if (wedge->sweep == 0) {
+		return false;
+	}
+
+	const int32_t from_start = wedge->start_x * dy - wedge->start_y * dx;
+	const int32_t to_end     = dx * wedge->end_y - dy * wedge->end_x;
+	if (wedge->sweep <= 180) {
+		return from_start >= 0 && to_end >= 0;
+	}
+	return from_start >= 0 || to_end >= 0;
+}
+
+static inline void _inknit_init_arc_bound(
+	struct inknit_arc_bound *bound, int32_t a, int32_t b, int32_t c, int32_t dy
+) {
+	const int32_t den   = a < 0 ? -a : a;
+	const int32_t numer = b * dy + c;
+	if (den == 0) {
+		bound->x        = numer;
+		bound->rem      = 0;
+		bound->den      = 1;
+		bound->step     = b;
+		bound->step_rem = 0;
+		bound->side     = 0;
+		return;
+	}
+
+	const int32_t quot = numer >= 0 ? numer / den : -((-numer + den - 1) / den);
+	const int32_t step = b >= 0 ? b / den : -((-b + den - 1) / den);
+
+	bound->x        = quot;
+	bound->rem      = numer - quot * den;
+	bound->den      = den;
+	bound->step     = step;
+	bound->step_rem = b - step * den;
+	bound->side     = a > 0 ? 1 : -1;
+}
+
+// Moves a bound down by one row
+static inline void _inknit_step_arc_bound(struct inknit_arc_bound *bound) {
+	bound->x   += bound->step;
+	bound->rem += bound->step_rem;
+	if (bound->rem >= bound->den) {
+		bound->x   += 1;
+		bound->rem -= bound->den;
+	}
+}
+
+// Narrows [*lo, *hi] to the half-line of the current row
+static inline void _inknit_clamp_arc_bound(
+	const struct inknit_arc_bound *bound, int32_t *lo, int32_t *hi
+) {
+	if (bound->side > 0) {
+		*hi = bound->x < *hi ? bound->x : *hi;
+	} else if (bound->side < 0) {
+		*lo = *lo < -bound->x ? -bound->x : *lo;
+	} else if (bound->x < 0) {
+		*lo = INKNIT_ARC_UNBOUNDED;
+		*hi = -INKNIT_ARC_UNBOUNDED;
+	}
+}
+
+// Sets up both bounds of the wedge for row dy. Up to a half turn the row keeps the pixels between
+// them; past that it drops the pixels strictly outside both rays, so the function returns true
+// when the interval is to be left out instead.
+static inline bool _inknit_init_arc_bounds(
+	struct inknit_arc_bound *bounds, const struct inknit_arc_wedge *wedge, int32_t dy
+) {
+	if (wedge->sweep >= 360 || wedge->sweep == 0) {
+		_inknit_init_arc_bound(&bounds[0], 0, 0, -1, dy);
+		_inknit_init_arc_bound(&bounds[1], 0, 0, -1, dy);
+		return wedge->sweep >= 360;
+	}
+	if (wedge->sweep <= 180) {
+		_inknit_init_arc_bound(&bounds[0], wedge->start_y, wedge->start_x, 0, dy);
+		_inknit_init_arc_bound(&bounds[1], -wedge->end_y, -wedge->end_x, 0, dy);
+		return false;
+	}
+	_inknit_init_arc_bound(&bounds[0], wedge->end_y, wedge->end_x, -1, dy);
+	_inknit_init_arc_bound(&bounds[1], -wedge->start_y, -wedge->start_x, -1, dy);
+	return true;
+}
+
+// Returns the half-width of row dy of inknit_fill_circle, or -1 outside it. A pixel (dx, dy) is
+// inside when dx^2 + dy^2 - max(dx, dy) < r^2. Rows must come in increasing order, which keeps the
+// half-width within a few steps of the previous one.
+static inline int32_t _inknit_next_circle_row(struct inknit_circle_rows *rows, int32_t dy) {
+	const int32_t ady = dy < 0 ? -dy : dy;
+	if (ady > rows->radius) {
+		return -1;
+	}
+	if (rows->radius == 0) {
+		return 0;
+	}
+
+	const int32_t dy_sq = ady * ady - rows->radius_sq;
+
+	int32_t dx = rows->dx;
+	for (;;) {
+		const int32_t next = dx + 1;
+		if (next * next + dy_sq - (next < ady ? ady : next) >= 0) {
+			break;
+		}
+		dx = next;
+	}
+	while (dx > 0 && dx * dx + dy_sq - (dx < ady ? ady : dx) >= 0) {
+		--dx;
+	}
+	rows->dx = dx;
+	return dx;
+}
+
+static inline void _inknit_init_circle_rows(struct inknit_circle_rows *rows, int32_t radius) {
+	rows->radius    = radius;
+	rows->radius_sq = radius * radius;
+	rows->dx        = 0;
+}
+
+void _inknit_make_arc_wedge(struct inknit_arc_wedge *wedge, int32_t start, int32_t end);
+
+void _inknit_get_arc_octants(
+	const struct inknit_arc_wedge *wedge, uint32_t *drawn, uint32_t *cut
+);
+
+void _inknit_get_arc_rows(
+	const struct inknit_arc_wedge *wedge,
+	int32_t                        radius,
+	int32_t                        hole,
+	int32_t                       *top,
+	int32_t                       *bottom
+);
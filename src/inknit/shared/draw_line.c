@@ -21,94 +21,68 @@
 
 #include "../macro_impl.h"
 
-static inline enum _inknit_line_outcode
-_inknit_compute_line_outcode(int32_t x, int32_t y, const struct inknit_rect *clip_rect) {
-	enum _inknit_line_outcode code = INKNIT_LINE_OUTCODE_INSIDE;
-
-	if (x < clip_rect->left) {
-		code |= INKNIT_LINE_OUTCODE_LEFT;
-	} else if (clip_rect->right <= x) {
-		code |= INKNIT_LINE_OUTCODE_RIGHT;
+// Clips a line to the pixels inside clip_rect without moving its endpoints. The walk is advanced
+// to the first visible pixel by computing its minor coordinate and error term directly, so the
+// visible pixels are exactly those of the unclipped line. Returns false if none are visible.
+//
+// With the error term e at the current pixel in (0, dx], the walk has taken
+// k(i) = floor((i * dy - e) / dx) + 1 minor steps after i more pixels on the major axis.
+bool _inknit_clip_line(struct _inknit_line *line, const struct inknit_rect *clip_rect) {
+	const int32_t major_min = line->steep ? clip_rect->top : clip_rect->left;
+	const int32_t major_max = (line->steep ? clip_rect->bottom : clip_rect->right) - 1;
+	const int32_t minor_min = line->steep ? clip_rect->left : clip_rect->top;
+	const int32_t minor_max = (line->steep ? clip_rect->right : clip_rect->bottom) - 1;
+
+	int32_t first = line->major > major_min ? line->major : major_min;
+	int32_t last  = line->last < major_max ? line->last : major_max;
+	if (first > last) {
+		return false;
 	}
 
-	if (y < clip_rect->top) {
-		code |= INKNIT_LINE_OUTCODE_TOP;
-	} else if (clip_rect->bottom <= y) {
-		code |= INKNIT_LINE_OUTCODE_BOTTOM;
+	const int32_t dx = line->dx;
+	const int32_t dy = line->dy;
+	const int32_t e  = line->err;
+	if (dy == 0) {
+		if (line->minor < minor_min || minor_max < line->minor) {
+			return false;
+		}
+		line->major = first;
+		line->last  = last;
+		return true;
 	}
 
-	return code;
-}
-
-static INKNIT_ALWAYS_INLINE int32_t
-_inknit_lerp(int32_t p1, int32_t p2, int32_t q1, int32_t q2, int32_t t) {
-	const int32_t dq = q2 - q1;
-	if (dq == 0) {
-		return p1;
+	// The walk is visible while enter <= k(i) <= leave
+	const int32_t enter = line->step > 0 ? minor_min - line->minor : line->minor - minor_max;
+	const int32_t leave = line->step > 0 ? minor_max - line->minor : line->minor - minor_min;
+	if (leave < 0) {
+		return false;
 	}
 
-	const int32_t FIXED_SHIFT = 6;
-
-	const int32_t dp    = p2 - p1;
-	const int32_t numer = dp * (t - q1);
-	const int32_t val   = p1 + ((numer << FIXED_SHIFT) / dq >> FIXED_SHIFT);
-	return val;
-}
-
-// Clips a line segment from (x1, y1) to (x2, y2) against clip_rect.
-// Returns true if the line should be drawn, and updates the endpoint
-// coordinates (x1, y1, x2, y2) by reference.
-bool _inknit_clip_line_to_bounds(
-	int32_t *INKNIT_RESTRICT                  x1,
-	int32_t *INKNIT_RESTRICT                  y1,
-	int32_t *INKNIT_RESTRICT                  x2,
-	int32_t *INKNIT_RESTRICT                  y2,
-	const struct inknit_rect *INKNIT_RESTRICT clip_rect
-) {
-	enum _inknit_line_outcode outcode1 = _inknit_compute_line_outcode(*x1, *y1, clip_rect);
-	enum _inknit_line_outcode outcode2 = _inknit_compute_line_outcode(*x2, *y2, clip_rect);
-
-	while (1) {
-		// Trivial Accept: both endpoints are inside the clipping rectangle.
-		if (!(outcode1 | outcode2)) {
-			return true;
+	if (enter > 0) {
+		// The smallest i with i * dy - e >= (enter - 1) * dx
+		const int32_t enter_at = line->major + ((enter - 1) * dx + e + dy - 1) / dy;
+		if (first < enter_at) {
+			first = enter_at;
 		}
+	}
 
-		// Trivial Reject: both endpoints are in the same outside region.
-		else if (outcode1 & outcode2) {
-			return false;
-		}
-
-		// Clipping required.
-		else {
-			enum _inknit_line_outcode outcode = outcode1 ? outcode1 : outcode2;
-			int32_t                   x, y;
-
-			if (outcode & INKNIT_LINE_OUTCODE_TOP) {
-				x = _inknit_lerp(*x1, *x2, *y1, *y2, clip_rect->top);
-				y = clip_rect->top;
-			} else if (outcode & INKNIT_LINE_OUTCODE_BOTTOM) {
-				x = _inknit_lerp(*x1, *x2, *y1, *y2, clip_rect->bottom);
-				y = clip_rect->bottom - 1;
-			} else if (outcode & INKNIT_LINE_OUTCODE_RIGHT) {
-				x = clip_rect->right - 1;
-				y = _inknit_lerp(*y1, *y2, *x1, *x2, clip_rect->right);
-			} else if (outcode & INKNIT_LINE_OUTCODE_LEFT) {
-				x = clip_rect->left;
-				y = _inknit_lerp(*y1, *y2, *x1, *x2, clip_rect->left);
-			}
+	// The largest i with i * dy - e < leave * dx
+	const int32_t leave_at = line->major + (leave * dx + e - 1) / dy;
+	if (leave_at < last) {
+		last = leave_at;
+	}
 
-			if (outcode == outcode1) {
-				*x1 = x;
-				*y1 = y;
+	if (first > last) {
+		return false;
+	}
 
-				outcode1 = _inknit_compute_line_outcode(x, y, clip_rect);
-			} else {
-				*x2 = x;
-				*y2 = y;
+	// The numerator is at least -dx, so a negative one always floors to -1
+	const int32_t numer = (first - line->major) * dy - e;
+	const int32_t steps = numer < 0 ? 0 : numer / dx + 1;
 
-				outcode2 = _inknit_compute_line_outcode(x, y, clip_rect);
-			}
-		}
-	}
+	line->major  = first;
+	line->minor += line->step * steps;
+	line->last   = last;
+	line->err    = steps * dx - numer;
+	return true;
 }
@@ -30,10 +30,83 @@ enum _inknit_line_outcode {
 	INKNIT_LINE_OUTCODE_TOP    = 1 << 4,
 };
 
-bool _inknit_clip_line_to_bounds(
-	int32_t *INKNIT_RESTRICT                  x1,
-	int32_t *INKNIT_RESTRICT                  y1,
-	int32_t *INKNIT_RESTRICT                  x2,
-	int32_t *INKNIT_RESTRICT                  y2,
-	const struct inknit_rect *INKNIT_RESTRICT clip_rect
-);
+static inline enum _inknit_line_outcode
+_inknit_compute_line_outcode(int32_t x, int32_t y, const struct inknit_rect *clip_rect) {
+	enum _inknit_line_outcode code = INKNIT_LINE_OUTCODE_INSIDE;
+
+	if (x < clip_rect->left) {
+		code |= INKNIT_LINE_OUTCODE_LEFT;
+	} else if (clip_rect->right <= x) {
+		code |= INKNIT_LINE_OUTCODE_RIGHT;
+	}
+
+	if (y < clip_rect->top) {
+		code |= INKNIT_LINE_OUTCODE_TOP;
+	} else if (clip_rect->bottom <= y) {
+		code |= INKNIT_LINE_OUTCODE_BOTTOM;
+	}
+
+	return code;
+}
+
+// Bresenham state of a line walked in increasing order along its major axis. `major` and `minor`
+// are the coordinates of the next pixel to draw, and `err` is the error term at that pixel.
+struct _inknit_line {
+	bool    steep;  // The major axis is y
+	int32_t major;  // Major coordinate of the next pixel
+	int32_t minor;  // Minor coordinate of the next pixel
+	int32_t last;   // Major coordinate of the last pixel
+	int32_t step;   // Minor step, 1 or -1
+	int32_t dx;     // Length along the major axis
+	int32_t dy;     // Absolute length along the minor axis
+	int32_t err;    // Error term at the next pixel, in (0, dx] while dy > 0
+};
+
+// Sets up the walk of the line from (x1, y1) to (x2, y2). A line is always walked from its lower
+// major coordinate, so both directions rasterize the same pixels. `skip_start` leaves out the
+// pixel at (x1, y1), which is either the first or the last pixel of the walk.
+static inline void _inknit_init_line(
+	struct _inknit_line *line, int32_t x1, int32_t y1, int32_t x2, int32_t y2, bool skip_start
+) {
+	const int32_t abs_dx = x1 < x2 ? x2 - x1 : x1 - x2;
+	const int32_t abs_dy = y1 < y2 ? y2 - y1 : y1 - y2;
+	const bool    steep  = abs_dx < abs_dy;
+
+	const int32_t major1 = steep ? y1 : x1;
+	const int32_t minor1 = steep ? x1 : y1;
+	const int32_t major2 = steep ? y2 : x2;
+	const int32_t minor2 = steep ? x2 : y2;
+
+	const bool    reverse = major1 > major2;
+	const int32_t from    = reverse ? minor2 : minor1;
+	const int32_t to      = reverse ? minor1 : minor2;
+	const int32_t dx      = steep ? abs_dy : abs_dx;
+	const int32_t dy      = steep ? abs_dx : abs_dy;
+
+	line->steep = steep;
+	line->major = reverse ? major2 : major1;
+	line->minor = from;
+	line->last  = reverse ? major1 : major2;
+	line->step  = from < to ? 1 : -1;
+	line->dx    = dx;
+	line->dy    = dy;
+
+	// A line with dx == 1 starts at err = 0, which steps exactly like err = dx. Starting at dx
+	// keeps the error term in (0, dx] for every line, which `_inknit_clip_line` relies on.
+	line->err = dx > 1 ? dx >> 1 : dx;
+
+	if (skip_start) {
+		if (reverse) {
+			--line->last;
+		} else {
+			++line->major;
+			line->err -= dy;
+			if (line->err <= 0) {
+				line->minor += line->step;
+				line->err   += dx;
+			}
+		}
+	}
+}
+
+bool _inknit_clip_line(struct _inknit_line *line, const struct inknit_rect *clip_rect);
@@ -0,0 +1,78 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "fill_polygon.h"
+
+#include "../inknit_impl.h"
+
+// Builds the edge table: one entry per non-horizontal edge, set up for its top row and sorted by
+// that row. An edge covers the rows whose centers lie between its endpoints, [top, bottom).
+// Returns the number of edges.
+uint32_t _inknit_build_polygon_edges(
+	struct inknit_polygon_edge *INKNIT_RESTRICT edges,
+	const struct inknit_point *INKNIT_RESTRICT  points,
+	uint32_t                                    count
+) {
+	uint32_t edge_count = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		const struct inknit_point p1 = points[i];
+		const struct inknit_point p2 = points[i + 1 < count ? i + 1 : 0];
+		INKNIT_ASSUME_COORD_X(p1.x);
+		INKNIT_ASSUME_COORD_Y(p1.y);
+
+		if (p1.y == p2.y) {
+			continue;
+		}
+
+		const bool    down = p1.y < p2.y;
+		const int32_t x0   = down ? p1.x : p2.x;
+		const int32_t y0   = down ? p1.y : p2.y;
+		const int32_t dx   = (down ? p2.x : p1.x) - x0;
+		const int32_t dy   = (down ? p2.y : p1.y) - y0;
+		const int32_t den  = dy << 1;
+
+		// At row y0 the crossing is x0 + dx / den, so the first pixel right of it is
+		// x0 + ceil((dx - dy) / den). Each row adds 2 * dx / den.
+		const int32_t numer    = dx - dy;
+		const int32_t quot     = numer >= 0 ? (numer + den - 1) / den : -(-numer / den);
+		const int32_t run      = dx * 2;
+		const int32_t step     = run >= 0 ? run / den : -((-run + den - 1) / den);
+		const int32_t step_rem = run - step * den;
+
+		struct inknit_polygon_edge edge = {
+			.x        = x0 + quot,
+			.step     = step,
+			.rem      = (int16_t)(quot * den - numer),
+			.step_rem = (int16_t)step_rem,
+			.den      = (int16_t)den,
+			.top      = (int16_t)y0,
+			.bottom   = (int16_t)(y0 + dy),
+			.winding  = down ? 1 : -1,
+		};
+
+		// Insertion into the table, which keeps edges with the same top row in outline order
+		uint32_t j = edge_count++;
+		while (j > 0 && edges[j - 1].top > edge.top) {
+			edges[j] = edges[j - 1];
+			--j;
+		}
+		edges[j] = edge;
+	}
+	return edge_count;
+}
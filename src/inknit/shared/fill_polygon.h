@@ -0,0 +1,88 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../inc/inknit/types.h"
+#include "../inc/inknit/macro.h"
+
+// Every edge keeps the first pixel right of it on the current row, which is the pixel
+// ceil(x - 1/2) for the crossing x at the row center. It is stepped exactly in integers: `x` is
+// the whole part and the fraction is (den - rem) / den with den = 2 * dy, so no rounding error
+// builds up along tall edges.
+
+// Moves an edge down by `rows` rows
+static inline void _inknit_advance_polygon_edge(struct inknit_polygon_edge *edge, int32_t rows) {
+	int32_t rem = edge->rem - edge->step_rem * rows;
+
+	edge->x += edge->step * rows;
+	if (rem < 0) {
+		const int32_t carry = (-rem + edge->den - 1) / edge->den;
+
+		edge->x += carry;
+		rem     += carry * edge->den;
+	}
+	edge->rem = (int16_t)rem;
+}
+
+// Moves an edge down by one row
+static inline void _inknit_step_polygon_edge(struct inknit_polygon_edge *edge) {
+	edge->x   += edge->step;
+	edge->rem -= edge->step_rem;
+	if (edge->rem < 0) {
+		edge->x   += 1;
+		edge->rem += edge->den;
+	}
+}
+
+// Sorts the active edges by `x`. The order barely changes from one row to the next, so an
+// insertion sort is close to linear.
+static inline void _inknit_sort_polygon_edges(struct inknit_polygon_edge *edges, uint32_t count) {
+	for (uint32_t i = 1; i < count; ++i) {
+		const struct inknit_polygon_edge edge = edges[i];
+
+		uint32_t j = i;
+		while (j > 0 && edges[j - 1].x > edge.x) {
+			edges[j] = edges[j - 1];
+			--j;
+		}
+		edges[j] = edge;
+	}
+}
+
+// A quad is convex when it turns the same way at every corner. Straight corners and folds turn
+// neither way, so those quads are left to the edge table.
+static inline bool _inknit_is_convex_quad(const struct inknit_point *points) {
+	int32_t turns = 0;
+	for (uint32_t i = 0; i < 4; ++i) {
+		const struct inknit_point p0 = points[i];
+		const struct inknit_point p1 = points[(i + 1) & 3];
+		const struct inknit_point p2 = points[(i + 2) & 3];
+
+		const int32_t cross = (p1.x - p0.x) * (p2.y - p1.y) - (p1.y - p0.y) * (p2.x - p1.x);
+		turns += (cross > 0) - (cross < 0);
+	}
+	return turns == 4 || turns == -4;
+}
+
+uint32_t _inknit_build_polygon_edges(
+	struct inknit_polygon_edge *INKNIT_RESTRICT edges,
+	const struct inknit_point *INKNIT_RESTRICT  points,
+	uint32_t                                    count
+);
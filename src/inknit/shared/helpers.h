@@ -87,3 +87,41 @@ static INKNIT_ALWAYS_INLINE bool clip_range_y_exclusive(
 	}
 	return *y1 <= *y2;
 }
+
+/**
+ * @brief Test whether an inclusive box lies entirely inside an exclusive rectangle.
+ *
+ * Shapes use this on their bounding box to skip clipping altogether.
+ *
+ * @param[in] left    Left edge of the box (inclusive).
+ * @param[in] top     Top edge of the box (inclusive).
+ * @param[in] right   Right edge of the box (inclusive).
+ * @param[in] bottom  Bottom edge of the box (inclusive).
+ * @param[in] rect    Pointer to the exclusive rectangle to test against.
+ *
+ * @retval true   If every pixel of the box is inside the rectangle.
+ * @retval false  If at least one pixel of the box is outside.
+ */
+static INKNIT_ALWAYS_INLINE bool box_inside_rect_exclusive(
+	int32_t left, int32_t top, int32_t right, int32_t bottom, const struct inknit_rect *rect
+) {
+	return rect->left <= left && right < rect->right && rect->top <= top && bottom < rect->bottom;
+}
+
+/**
+ * @brief Test whether an inclusive box lies entirely outside an exclusive rectangle.
+ *
+ * @param[in] left    Left edge of the box (inclusive).
+ * @param[in] top     Top edge of the box (inclusive).
+ * @param[in] right   Right edge of the box (inclusive).
+ * @param[in] bottom  Bottom edge of the box (inclusive).
+ * @param[in] rect    Pointer to the exclusive rectangle to test against.
+ *
+ * @retval true   If the box and the rectangle share no pixel.
+ * @retval false  If at least one pixel of the box is inside the rectangle.
+ */
+static INKNIT_ALWAYS_INLINE bool box_outside_rect_exclusive(
+	int32_t left, int32_t top, int32_t right, int32_t bottom, const struct inknit_rect *rect
+) {
+	return right < rect->left || rect->right <= left || bottom < rect->top || rect->bottom <= top;
+}
@@ -0,0 +1,42 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "../inc/inknit/pattern.h"
+
+#include "../inknit_impl.h"
+
+// The 8x8 Bayer matrix holds 16 b(x, y) + 4 b(x / 2, y / 2) + b(x / 4, y / 4), where b is the 2x2
+// matrix {{0, 2}, {3, 1}} at the lowest bits, or 2 (x ^ y) + y. A pixel is set when its entry is
+// below `level`; pattern bytes hold the leftmost pixel at the highest bit.
+void inknit_make_dither_pattern(uint8_t *pattern, int32_t level) {
+	INKNIT_ASSUME_RANGE(
+		level, 0, INKNIT_DITHER_MAX, MSG_LEVEL_LESS_THAN_ZERO, MSG_LEVEL_GREATER_THAN_DITHER
+	);
+
+	for (uint32_t y = 0; y < 8; ++y) {
+		uint32_t bits = 0;
+		for (uint32_t x = 0; x < 8; ++x) {
+			const uint32_t d      = x ^ y;
+			const uint32_t fine   = (d & 1) << 5 | (y & 1) << 4;
+			const uint32_t mid    = (d & 2) << 2 | (y & 2) << 1;
+			const uint32_t coarse = (d & 4) >> 1 | (y & 4) >> 2;
+			bits                  = bits << 1 | (uint32_t)((fine | mid | coarse) < (uint32_t)level);
+		}
+		pattern[y] = (uint8_t)bits;
+	}
+}
@@ -0,0 +1,46 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "round_corner.h"
+
+#include "../inknit_impl.h"
+
+// Row i of the corner is row dy = radius - i of a circle, whose half-width is the largest dx with
+// dx^2 + dy^2 - max(dx, dy) < r^2 (see fill/circle.c.in). It only grows while dy shrinks.
+void inknit_make_round_corner(uint8_t *insets, int32_t radius) {
+	INKNIT_ASSUME_RANGE(
+		radius, 0, INKNIT_CORNER_MAX, MSG_RADIUS_LESS_THAN_ZERO, MSG_RADIUS_GREATER_THAN_CORNER
+	);
+
+	const int32_t radius_sq = radius * radius;
+
+	int32_t dx = 0;
+	for (int32_t dy = radius; dy > 0; --dy) {
+		const int32_t dy_sq = dy * dy;
+		for (;;) {
+			const int32_t next = dx + 1;
+			const int32_t bias = next < dy ? dy : next;
+			if (next * next + dy_sq - bias >= radius_sq) {
+				break;
+			}
+			dx = next;
+		}
+		insets[radius - dy] = (uint8_t)(radius - dx);
+	}
+}
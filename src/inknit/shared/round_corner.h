@@ -0,0 +1,40 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../inc/inknit/corner.h"
+#include "../inc/inknit/macro.h"
+
+// Returns how far row y of the round rect over rows [top, bottom] starts inside its left and right
+// edges, or `outside` for rows above or below it
+static inline int32_t _inknit_round_rect_inset(
+	const uint8_t *insets, int32_t radius, int32_t top, int32_t bottom, int32_t y, int32_t outside
+) {
+	if (y < top || bottom < y) {
+		return outside;
+	}
+	if (y - top < radius) {
+		return insets[y - top];
+	}
+	if (bottom - y < radius) {
+		return insets[bottom - y];
+	}
+	return 0;
+}
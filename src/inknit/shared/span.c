@@ -0,0 +1,75 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/inknit/span_internal.h"
+
+// Portable reference kernels. They are only built for the benchmarks, which compare them against
+// the SIMD kernels selected for the target.
+
+#if defined(INKNIT_ENABLE_BENCHMARKS) && defined(INKNIT_ENABLE_SPAN_SIMD)
+void _inknit_span_fill_scalar(void *data, uint8_t pattern, uint32_t bytes) {
+	uint32_t *const words     = (uint32_t *)data;
+	const uint32_t  pattern32 = (uint32_t)pattern * 0x01010101u;
+	for (uint32_t i = 0; i < (bytes >> 2); ++i) {
+		words[i] = pattern32;
+	}
+}
+
+void _inknit_span_copy_scalar(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes
+) {
+	uint32_t *const       dst_words = (uint32_t *)dst;
+	const uint32_t *const src_words = (const uint32_t *)src;
+	for (uint32_t i = 0; i < (bytes >> 2); ++i) {
+		dst_words[i] = src_words[i];
+	}
+}
+
+void _inknit_span_swap_order_scalar(void *dst, const void *src, uint32_t bpp, uint32_t bytes) {
+	uint32_t *const       dst_words = (uint32_t *)dst;
+	const uint32_t *const src_words = (const uint32_t *)src;
+	for (uint32_t i = 0; i < (bytes >> 2); ++i) {
+		dst_words[i] = _inknit_span_swap_order_u32(src_words[i], bpp);
+	}
+}
+#endif
+
+#if defined(INKNIT_ENABLE_BENCHMARKS) && defined(INKNIT_ENABLE_SPAN_STITCH)
+void _inknit_span_stitch_msb_scalar(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+	for (uint32_t i = 0; i < bytes; ++i) {
+		const uint32_t window = ((uint32_t)src_ptr[i] << 8) | src_ptr[i + 1];
+		dst_ptr[i]            = (uint8_t)(window >> (8 - shift));
+	}
+}
+
+void _inknit_span_stitch_lsb_scalar(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+	for (uint32_t i = 0; i < bytes; ++i) {
+		const uint32_t window = ((uint32_t)src_ptr[i + 1] << 8) | src_ptr[i];
+		dst_ptr[i]            = (uint8_t)(window >> shift);
+	}
+}
+#endif
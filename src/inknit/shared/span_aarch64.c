@@ -0,0 +1,186 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/inknit/span_internal.h"
+
+#include <arm_neon.h>
+
+#include "../macro_impl.h"
+
+// Rows are only guaranteed to be word-aligned, and `vld1q_u8`/`vst1q_u8` have no alignment
+// requirement. Remainders are handled with one overlapping vector at the end of the span, which is
+// safe because every kernel writes each destination byte from the source alone.
+
+static INKNIT_ALWAYS_INLINE void
+_inknit_span_fill_small(uint8_t *data, uint8x8_t vpattern, uint32_t bytes) {
+	// bytes: 4, 8 or 12
+	if (bytes >= 8) {
+		vst1_u8(data, vpattern);
+		vst1_u8(data + bytes - 8, vpattern);
+	} else if (bytes != 0) {
+		vst1_lane_u32((uint32_t *)data, vreinterpret_u32_u8(vpattern), 0);
+	}
+}
+
+static INKNIT_ALWAYS_INLINE void _inknit_span_copy_small(
+	uint8_t *INKNIT_RESTRICT dst, const uint8_t *INKNIT_RESTRICT src, uint32_t bytes
+) {
+	// bytes: 4, 8 or 12
+	if (bytes >= 8) {
+		const uint8x8_t head = vld1_u8(src);
+		const uint8x8_t tail = vld1_u8(src + bytes - 8);
+		vst1_u8(dst, head);
+		vst1_u8(dst + bytes - 8, tail);
+	} else if (bytes != 0) {
+		const uint32x2_t word = vld1_dup_u32((const uint32_t *)src);
+		vst1_lane_u32((uint32_t *)dst, word, 0);
+	}
+}
+
+void _inknit_span_fill_neon(void *data, uint8_t pattern, uint32_t bytes) {
+	uint8_t *const ptr = (uint8_t *)data;
+
+	const uint8x16_t vpattern = vdupq_n_u8(pattern);
+	if (bytes < 16) {
+		_inknit_span_fill_small(ptr, vget_low_u8(vpattern), bytes);
+		return;
+	}
+
+	uint32_t offset = 0;
+	for (; offset + 64 <= bytes; offset += 64) {
+		vst1q_u8(ptr + offset + 0, vpattern);
+		vst1q_u8(ptr + offset + 16, vpattern);
+		vst1q_u8(ptr + offset + 32, vpattern);
+		vst1q_u8(ptr + offset + 48, vpattern);
+	}
+	for (; offset + 16 <= bytes; offset += 16) {
+		vst1q_u8(ptr + offset, vpattern);
+	}
+	if (offset != bytes) {
+		vst1q_u8(ptr + bytes - 16, vpattern);
+	}
+}
+
+void _inknit_span_copy_neon(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes
+) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+
+	if (bytes < 16) {
+		_inknit_span_copy_small(dst_ptr, src_ptr, bytes);
+		return;
+	}
+
+	uint32_t offset = 0;
+	for (; offset + 64 <= bytes; offset += 64) {
+		const uint8x16_t v0 = vld1q_u8(src_ptr + offset + 0);
+		const uint8x16_t v1 = vld1q_u8(src_ptr + offset + 16);
+		const uint8x16_t v2 = vld1q_u8(src_ptr + offset + 32);
+		const uint8x16_t v3 = vld1q_u8(src_ptr + offset + 48);
+		vst1q_u8(dst_ptr + offset + 0, v0);
+		vst1q_u8(dst_ptr + offset + 16, v1);
+		vst1q_u8(dst_ptr + offset + 32, v2);
+		vst1q_u8(dst_ptr + offset + 48, v3);
+	}
+	for (; offset + 16 <= bytes; offset += 16) {
+		vst1q_u8(dst_ptr + offset, vld1q_u8(src_ptr + offset));
+	}
+	if (offset != bytes) {
+		vst1q_u8(dst_ptr + bytes - 16, vld1q_u8(src_ptr + bytes - 16));
+	}
+}
+
+// `vrbitq_u8` reverses the bits of every byte, which is the whole conversion for 1 bpp; 2 bpp swaps
+// the bits of each pair back afterwards. The tail is scalar because the kernel may run in place.
+void _inknit_span_swap_order_neon(void *dst, const void *src, uint32_t bpp, uint32_t bytes) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+
+	const uint8x16_t mask1 = vdupq_n_u8(0x55);
+
+	uint32_t offset = 0;
+	for (; offset + 16 <= bytes; offset += 16) {
+		uint8x16_t v = vld1q_u8(src_ptr + offset);
+		if (bpp == 4) {
+			v = vorrq_u8(vshrq_n_u8(v, 4), vshlq_n_u8(v, 4));
+		} else {
+			v = vrbitq_u8(v);
+			if (bpp == 2) {
+				v = vorrq_u8(vandq_u8(vshrq_n_u8(v, 1), mask1), vshlq_n_u8(vandq_u8(v, mask1), 1));
+			}
+		}
+		vst1q_u8(dst_ptr + offset, v);
+	}
+	for (; offset < bytes; offset += 4) {
+		const uint32_t value            = *(const uint32_t *)(src_ptr + offset);
+		*(uint32_t *)(dst_ptr + offset) = _inknit_span_swap_order_u32(value, bpp);
+	}
+}
+
+// `vshlq_u8` shifts right for negative counts and yields 0 for |count| == 8, so one routine
+// covers both bit orders and shift == 0 without branches:
+//   MSB-first: dst = (src[i] << shift) | (src[i + 1] >> (8 - shift))
+//   LSB-first: dst = (src[i] >> shift) | (src[i + 1] << (8 - shift))
+static INKNIT_ALWAYS_INLINE void _inknit_span_stitch_neon(
+	uint8_t *INKNIT_RESTRICT       dst,
+	const uint8_t *INKNIT_RESTRICT src,
+	int8_t                         shift_lo,
+	int8_t                         shift_hi,
+	uint32_t                       bytes
+) {
+	const int8x16_t vshift_lo = vdupq_n_s8(shift_lo);
+	const int8x16_t vshift_hi = vdupq_n_s8(shift_hi);
+
+	uint32_t offset = 0;
+	for (; offset + 32 <= bytes; offset += 32) {
+		const uint8x16_t lo0 = vld1q_u8(src + offset + 0);
+		const uint8x16_t hi0 = vld1q_u8(src + offset + 1);
+		const uint8x16_t lo1 = vld1q_u8(src + offset + 16);
+		const uint8x16_t hi1 = vld1q_u8(src + offset + 17);
+		vst1q_u8(dst + offset + 0, vorrq_u8(vshlq_u8(lo0, vshift_lo), vshlq_u8(hi0, vshift_hi)));
+		vst1q_u8(dst + offset + 16, vorrq_u8(vshlq_u8(lo1, vshift_lo), vshlq_u8(hi1, vshift_hi)));
+	}
+	for (; offset + 16 <= bytes; offset += 16) {
+		const uint8x16_t lo = vld1q_u8(src + offset);
+		const uint8x16_t hi = vld1q_u8(src + offset + 1);
+		vst1q_u8(dst + offset, vorrq_u8(vshlq_u8(lo, vshift_lo), vshlq_u8(hi, vshift_hi)));
+	}
+	if (offset != bytes) {
+		const uint8x16_t lo = vld1q_u8(src + bytes - 16);
+		const uint8x16_t hi = vld1q_u8(src + bytes - 15);
+		vst1q_u8(dst + bytes - 16, vorrq_u8(vshlq_u8(lo, vshift_lo), vshlq_u8(hi, vshift_hi)));
+	}
+}
+
+void _inknit_span_stitch_msb_neon(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) {
+	_inknit_span_stitch_neon(
+		(uint8_t *)dst, (const uint8_t *)src, (int8_t)shift, (int8_t)((int32_t)shift - 8), bytes
+	);
+}
+
+void _inknit_span_stitch_lsb_neon(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t shift, uint32_t bytes
+) {
+	_inknit_span_stitch_neon(
+		(uint8_t *)dst, (const uint8_t *)src, (int8_t)(-(int32_t)shift), (int8_t)(8 - shift), bytes
+	);
+}
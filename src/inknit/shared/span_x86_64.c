@@ -0,0 +1,263 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "../inc/inknit/span_internal.h"
+
+#include <immintrin.h>
+
+#include "../macro_impl.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define INKNIT_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define INKNIT_TARGET_AVX2
+#endif
+
+// Rows are only guaranteed to be word-aligned, so every vector access is unaligned. Remainders are
+// handled with one overlapping vector at the end of the span instead of a scalar loop, which also
+// keeps the compiler from turning the tail into a `memcpy`/`memset` call.
+
+static INKNIT_ALWAYS_INLINE void
+_inknit_span_fill_small(uint8_t *data, __m128i vpattern, uint32_t bytes) {
+	// bytes: 4, 8 or 12
+	if (bytes >= 8) {
+		_mm_storel_epi64((__m128i *)data, vpattern);
+		_mm_storel_epi64((__m128i *)(data + bytes - 8), vpattern);
+	} else if (bytes != 0) {
+		*(uint32_t *)data = (uint32_t)_mm_cvtsi128_si32(vpattern);
+	}
+}
+
+static INKNIT_ALWAYS_INLINE void _inknit_span_copy_small(
+	uint8_t *INKNIT_RESTRICT dst, const uint8_t *INKNIT_RESTRICT src, uint32_t bytes
+) {
+	// bytes: 4, 8 or 12
+	if (bytes >= 8) {
+		const __m128i head = _mm_loadl_epi64((const __m128i *)src);
+		const __m128i tail = _mm_loadl_epi64((const __m128i *)(src + bytes - 8));
+		_mm_storel_epi64((__m128i *)dst, head);
+		_mm_storel_epi64((__m128i *)(dst + bytes - 8), tail);
+	} else if (bytes != 0) {
+		*(uint32_t *)dst = *(const uint32_t *)src;
+	}
+}
+
+// The swap-order kernels may run in place, so their tails use the scalar form instead of an
+// overlapping vector.
+static INKNIT_ALWAYS_INLINE void _inknit_span_swap_order_tail(
+	uint8_t *dst, const uint8_t *src, uint32_t bpp, uint32_t offset, uint32_t bytes
+) {
+	for (; offset < bytes; offset += 4) {
+		const uint32_t value        = *(const uint32_t *)(src + offset);
+		*(uint32_t *)(dst + offset) = _inknit_span_swap_order_u32(value, bpp);
+	}
+}
+
+#ifdef INKNIT_ENABLE_SPAN_SSE2
+static INKNIT_ALWAYS_INLINE __m128i _inknit_span_swap_order_vec128(__m128i value, uint32_t bpp) {
+	// Same ladder as _inknit_span_swap_order_u32; the byte masks make 16-bit shifts safe
+	__m128i hi = _mm_and_si128(_mm_srli_epi16(value, 4), _mm_set1_epi8(0x0F));
+	__m128i lo = _mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi8(0x0F)), 4);
+	value      = _mm_or_si128(hi, lo);
+	if (bpp <= 2) {
+		hi    = _mm_and_si128(_mm_srli_epi16(value, 2), _mm_set1_epi8(0x33));
+		lo    = _mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi8(0x33)), 2);
+		value = _mm_or_si128(hi, lo);
+	}
+	if (bpp <= 1) {
+		hi    = _mm_and_si128(_mm_srli_epi16(value, 1), _mm_set1_epi8(0x55));
+		lo    = _mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi8(0x55)), 1);
+		value = _mm_or_si128(hi, lo);
+	}
+	return value;
+}
+
+void _inknit_span_fill_sse2(void *data, uint8_t pattern, uint32_t bytes) {
+	uint8_t *const ptr = (uint8_t *)data;
+
+	const __m128i vpattern = _mm_set1_epi8((char)pattern);
+	if (bytes < 16) {
+		_inknit_span_fill_small(ptr, vpattern, bytes);
+		return;
+	}
+
+	uint32_t offset = 0;
+	for (; offset + 64 <= bytes; offset += 64) {
+		_mm_storeu_si128((__m128i *)(ptr + offset + 0), vpattern);
+		_mm_storeu_si128((__m128i *)(ptr + offset + 16), vpattern);
+		_mm_storeu_si128((__m128i *)(ptr + offset + 32), vpattern);
+		_mm_storeu_si128((__m128i *)(ptr + offset + 48), vpattern);
+	}
+	for (; offset + 16 <= bytes; offset += 16) {
+		_mm_storeu_si128((__m128i *)(ptr + offset), vpattern);
+	}
+	if (offset != bytes) {
+		_mm_storeu_si128((__m128i *)(ptr + bytes - 16), vpattern);
+	}
+}
+
+void _inknit_span_copy_sse2(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes
+) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+
+	if (bytes < 16) {
+		_inknit_span_copy_small(dst_ptr, src_ptr, bytes);
+		return;
+	}
+
+	uint32_t offset = 0;
+	for (; offset + 64 <= bytes; offset += 64) {
+		const __m128i v0 = _mm_loadu_si128((const __m128i *)(src_ptr + offset + 0));
+		const __m128i v1 = _mm_loadu_si128((const __m128i *)(src_ptr + offset + 16));
+		const __m128i v2 = _mm_loadu_si128((const __m128i *)(src_ptr + offset + 32));
+		const __m128i v3 = _mm_loadu_si128((const __m128i *)(src_ptr + offset + 48));
+		_mm_storeu_si128((__m128i *)(dst_ptr + offset + 0), v0);
+		_mm_storeu_si128((__m128i *)(dst_ptr + offset + 16), v1);
+		_mm_storeu_si128((__m128i *)(dst_ptr + offset + 32), v2);
+		_mm_storeu_si128((__m128i *)(dst_ptr + offset + 48), v3);
+	}
+	for (; offset + 16 <= bytes; offset += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(src_ptr + offset));
+		_mm_storeu_si128((__m128i *)(dst_ptr + offset), v);
+	}
+	if (offset != bytes) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(src_ptr + bytes - 16));
+		_mm_storeu_si128((__m128i *)(dst_ptr + bytes - 16), v);
+	}
+}
+
+void _inknit_span_swap_order_sse2(void *dst, const void *src, uint32_t bpp, uint32_t bytes) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+
+	uint32_t offset = 0;
+	for (; offset + 16 <= bytes; offset += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(src_ptr + offset));
+		_mm_storeu_si128((__m128i *)(dst_ptr + offset), _inknit_span_swap_order_vec128(v, bpp));
+	}
+	_inknit_span_swap_order_tail(dst_ptr, src_ptr, bpp, offset, bytes);
+}
+#endif
+
+#ifdef INKNIT_ENABLE_SPAN_AVX2
+INKNIT_TARGET_AVX2
+static INKNIT_ALWAYS_INLINE __m256i _inknit_span_swap_order_vec256(__m256i value, uint32_t bpp) {
+	// Same ladder as _inknit_span_swap_order_u32; the byte masks make 16-bit shifts safe
+	__m256i hi = _mm256_and_si256(_mm256_srli_epi16(value, 4), _mm256_set1_epi8(0x0F));
+	__m256i lo = _mm256_slli_epi16(_mm256_and_si256(value, _mm256_set1_epi8(0x0F)), 4);
+	value      = _mm256_or_si256(hi, lo);
+	if (bpp <= 2) {
+		hi    = _mm256_and_si256(_mm256_srli_epi16(value, 2), _mm256_set1_epi8(0x33));
+		lo    = _mm256_slli_epi16(_mm256_and_si256(value, _mm256_set1_epi8(0x33)), 2);
+		value = _mm256_or_si256(hi, lo);
+	}
+	if (bpp <= 1) {
+		hi    = _mm256_and_si256(_mm256_srli_epi16(value, 1), _mm256_set1_epi8(0x55));
+		lo    = _mm256_slli_epi16(_mm256_and_si256(value, _mm256_set1_epi8(0x55)), 1);
+		value = _mm256_or_si256(hi, lo);
+	}
+	return value;
+}
+
+INKNIT_TARGET_AVX2
+void _inknit_span_fill_avx2(void *data, uint8_t pattern, uint32_t bytes) {
+	uint8_t *const ptr = (uint8_t *)data;
+
+	const __m256i vpattern = _mm256_set1_epi8((char)pattern);
+	if (bytes < 32) {
+		const __m128i vpattern128 = _mm256_castsi256_si128(vpattern);
+		if (bytes >= 16) {
+			_mm_storeu_si128((__m128i *)ptr, vpattern128);
+			_mm_storeu_si128((__m128i *)(ptr + bytes - 16), vpattern128);
+		} else {
+			_inknit_span_fill_small(ptr, vpattern128, bytes);
+		}
+		return;
+	}
+
+	uint32_t offset = 0;
+	for (; offset + 128 <= bytes; offset += 128) {
+		_mm256_storeu_si256((__m256i *)(ptr + offset + 0), vpattern);
+		_mm256_storeu_si256((__m256i *)(ptr + offset + 32), vpattern);
+		_mm256_storeu_si256((__m256i *)(ptr + offset + 64), vpattern);
+		_mm256_storeu_si256((__m256i *)(ptr + offset + 96), vpattern);
+	}
+	for (; offset + 32 <= bytes; offset += 32) {
+		_mm256_storeu_si256((__m256i *)(ptr + offset), vpattern);
+	}
+	if (offset != bytes) {
+		_mm256_storeu_si256((__m256i *)(ptr + bytes - 32), vpattern);
+	}
+}
+
+INKNIT_TARGET_AVX2
+void _inknit_span_copy_avx2(
+	void *INKNIT_RESTRICT dst, const void *INKNIT_RESTRICT src, uint32_t bytes
+) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+
+	if (bytes < 32) {
+		if (bytes >= 16) {
+			const __m128i head = _mm_loadu_si128((const __m128i *)src_ptr);
+			const __m128i tail = _mm_loadu_si128((const __m128i *)(src_ptr + bytes - 16));
+			_mm_storeu_si128((__m128i *)dst_ptr, head);
+			_mm_storeu_si128((__m128i *)(dst_ptr + bytes - 16), tail);
+		} else {
+			_inknit_span_copy_small(dst_ptr, src_ptr, bytes);
+		}
+		return;
+	}
+
+	uint32_t offset = 0;
+	for (; offset + 128 <= bytes; offset += 128) {
+		const __m256i v0 = _mm256_loadu_si256((const __m256i *)(src_ptr + offset + 0));
+		const __m256i v1 = _mm256_loadu_si256((const __m256i *)(src_ptr + offset + 32));
+		const __m256i v2 = _mm256_loadu_si256((const __m256i *)(src_ptr + offset + 64));
+		const __m256i v3 = _mm256_loadu_si256((const __m256i *)(src_ptr + offset + 96));
+		_mm256_storeu_si256((__m256i *)(dst_ptr + offset + 0), v0);
+		_mm256_storeu_si256((__m256i *)(dst_ptr + offset + 32), v1);
+		_mm256_storeu_si256((__m256i *)(dst_ptr + offset + 64), v2);
+		_mm256_storeu_si256((__m256i *)(dst_ptr + offset + 96), v3);
+	}
+	for (; offset + 32 <= bytes; offset += 32) {
+		const __m256i v = _mm256_loadu_si256((const __m256i *)(src_ptr + offset));
+		_mm256_storeu_si256((__m256i *)(dst_ptr + offset), v);
+	}
+	if (offset != bytes) {
+		const __m256i v = _mm256_loadu_si256((const __m256i *)(src_ptr + bytes - 32));
+		_mm256_storeu_si256((__m256i *)(dst_ptr + bytes - 32), v);
+	}
+}
+
+INKNIT_TARGET_AVX2
+void _inknit_span_swap_order_avx2(void *dst, const void *src, uint32_t bpp, uint32_t bytes) {
+	uint8_t *const       dst_ptr = (uint8_t *)dst;
+	const uint8_t *const src_ptr = (const uint8_t *)src;
+
+	uint32_t offset = 0;
+	for (; offset + 32 <= bytes; offset += 32) {
+		const __m256i v = _mm256_loadu_si256((const __m256i *)(src_ptr + offset));
+		_mm256_storeu_si256((__m256i *)(dst_ptr + offset), _inknit_span_swap_order_vec256(v, bpp));
+	}
+	_inknit_span_swap_order_tail(dst_ptr, src_ptr, bpp, offset, bytes);
+}
+#endif
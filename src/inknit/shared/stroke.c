@@ -0,0 +1,158 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "stroke.h"
+
+#include "../inknit_impl.h"
+
+// Returns floor(sqrt(value))
+static uint32_t _inknit_sqrt64(uint64_t value) {
+	uint64_t root = 0;
+	uint64_t bit  = (uint64_t)1 << 62;
+	while (bit > value) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (value >= root + bit) {
+			value -= root + bit;
+			root   = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint32_t)root;
+}
+
+// Returns round(numer / den) for den > 0
+static inline int32_t _inknit_round_div64(int64_t numer, int64_t den) {
+	return (int32_t)(numer >= 0 ? (numer + (den >> 1)) / den : -((-numer + (den >> 1)) / den));
+}
+
+// Sets the offsets of a band `thickness` pixels wide along the direction (dx, dy): `across` is
+// half the thickness, a quarter turn clockwise from the direction, and `along` is half a pixel in
+// the direction. A point has no direction, so its band is a square.
+void _inknit_get_stroke_offsets(
+	int32_t                     dx,
+	int32_t                     dy,
+	int32_t                     thickness,
+	struct inknit_stroke_point *across,
+	struct inknit_stroke_point *along
+) {
+	const int32_t half = thickness * INKNIT_STROKE_HALF;
+	if (dx == 0 && dy == 0) {
+		across->x = 0;
+		across->y = half;
+		along->x  = half;
+		along->y  = 0;
+		return;
+	}
+
+	// The length is taken with 8 more bits, which keeps the rounding of short directions small
+	const uint64_t square = (uint64_t)((int64_t)dx * dx + (int64_t)dy * dy);
+	const int64_t  length = _inknit_sqrt64(square << 16);
+
+	across->x = _inknit_round_div64((int64_t)-dy * half * 256, length);
+	across->y = _inknit_round_div64((int64_t)dx * half * 256, length);
+	along->x  = _inknit_round_div64((int64_t)dx * INKNIT_STROKE_HALF * 256, length);
+	along->y  = _inknit_round_div64((int64_t)dy * INKNIT_STROKE_HALF * 256, length);
+}
+
+// Sets the tip of a miter join, relative to the vertex, from the offsets of both bands on the
+// outer side of the turn. Returns false when the tip would lie more than twice the thickness from
+// the vertex, which is where the angle between the bands drops below about 29 degrees.
+bool _inknit_get_stroke_miter(
+	struct inknit_stroke_point  outer1,
+	struct inknit_stroke_point  outer2,
+	struct inknit_stroke_point *miter
+) {
+	// With h the half thickness, the tip is (outer1 + outer2) * h^2 / (h^2 + outer1 . outer2), at
+	// h * sqrt(2 / (1 + cos)) from the vertex for the angle between the offsets. The limit of
+	// 4 * h is cos >= -7 / 8.
+	const int32_t square1 = outer1.x * outer1.x + outer1.y * outer1.y;
+	const int32_t square2 = outer2.x * outer2.x + outer2.y * outer2.y;
+	const int32_t square  = (square1 + square2) >> 1;
+	const int32_t dot     = outer1.x * outer2.x + outer1.y * outer2.y;
+	if (dot * 8 < square * -7) {
+		return false;
+	}
+
+	const int64_t den = square + dot;
+	miter->x          = _inknit_round_div64((int64_t)(outer1.x + outer2.x) * square, den);
+	miter->y          = _inknit_round_div64((int64_t)(outer1.y + outer2.y) * square, den);
+	return true;
+}
+
+// Builds the edge table like _inknit_build_polygon_edges: one entry per edge that crosses a row
+// center, sorted by its top row. Edges that start above `first_row` are set up for that row.
+// Returns the number of edges.
+uint32_t _inknit_build_stroke_edges(
+	struct inknit_stroke_edge *INKNIT_RESTRICT        edges,
+	const struct inknit_stroke_point *INKNIT_RESTRICT points,
+	uint32_t                                          count,
+	int32_t                                           first_row
+) {
+	uint32_t edge_count = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		const struct inknit_stroke_point p1 = points[i];
+		const struct inknit_stroke_point p2 = points[i + 1 < count ? i + 1 : 0];
+
+		// The rows whose centers lie in [y0, y0 + dy)
+		const bool    down   = p1.y < p2.y;
+		const int32_t y0     = down ? p1.y : p2.y;
+		const int32_t y1     = down ? p2.y : p1.y;
+		const int32_t top    = (y0 + INKNIT_STROKE_HALF - 1) >> INKNIT_STROKE_SHIFT;
+		const int32_t bottom = (y1 + INKNIT_STROKE_HALF - 1) >> INKNIT_STROKE_SHIFT;
+		if (top >= bottom) {
+			continue;
+		}
+
+		const int32_t x0  = down ? p1.x : p2.x;
+		const int32_t dx  = (down ? p2.x : p1.x) - x0;
+		const int32_t dy  = y1 - y0;
+		const int32_t den = dy * INKNIT_STROKE_UNIT;
+
+		// On row y the first pixel right of the edge is ceil(numer / den) with
+		// numer = (x0 - half) * dy + dx * (center of y - y0). Each row adds UNIT * dx / den.
+		const int32_t row   = top < first_row ? first_row : top;
+		const int64_t numer = (int64_t)(x0 - INKNIT_STROKE_HALF) * dy
+			+ (int64_t)dx * (row * INKNIT_STROKE_UNIT + INKNIT_STROKE_HALF - y0);
+		const int64_t quot     = numer >= 0 ? (numer + den - 1) / den : -(-numer / den);
+		const int32_t run      = dx * INKNIT_STROKE_UNIT;
+		const int32_t step     = run >= 0 ? run / den : -((-run + den - 1) / den);
+		const int32_t step_rem = run - step * den;
+
+		struct inknit_stroke_edge edge = {
+			.x        = (int32_t)quot,
+			.rem      = (int32_t)(quot * den - numer),
+			.den      = den,
+			.step     = step,
+			.step_rem = step_rem,
+			.top      = top,
+			.bottom   = bottom,
+		};
+
+		uint32_t j = edge_count++;
+		while (j > 0 && edges[j - 1].top > edge.top) {
+			edges[j] = edges[j - 1];
+			--j;
+		}
+		edges[j] = edge;
+	}
+	return edge_count;
+}
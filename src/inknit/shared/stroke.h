@@ -0,0 +1,89 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "../inc/inknit/types.h"
+#include "../inc/inknit/macro.h"
+
+// A stroke is filled as convex outlines whose corners are in fixed point, INKNIT_STROKE_UNIT per
+// pixel, so the sides of a tilted band stay parallel instead of snapping to pixel corners. Pixel
+// corners lie on multiples of the unit, and a pixel is inside when its center is, with the same
+// rule as inknit_fill_polygon.
+
+#define INKNIT_STROKE_SHIFT 4
+#define INKNIT_STROKE_UNIT  (1 << INKNIT_STROKE_SHIFT)
+#define INKNIT_STROKE_HALF  (INKNIT_STROKE_UNIT >> 1)
+
+struct inknit_stroke_point {
+	int32_t x;
+	int32_t y;
+};
+
+// An edge of a stroke outline, stepped like struct inknit_polygon_edge. The fraction has
+// den = INKNIT_STROKE_UNIT * dy, which needs 32 bits, and `x` starts on the first row that is
+// drawn, so the walk never advances it by more than a row.
+struct inknit_stroke_edge {
+	int32_t x;
+	int32_t rem;
+	int32_t den;
+	int32_t step;
+	int32_t step_rem;
+	int32_t top;
+	int32_t bottom;
+};
+
+// Returns the center of pixel (x, y)
+static inline struct inknit_stroke_point _inknit_get_stroke_center(int32_t x, int32_t y) {
+	const struct inknit_stroke_point center = {
+		x * INKNIT_STROKE_UNIT + INKNIT_STROKE_HALF,
+		y * INKNIT_STROKE_UNIT + INKNIT_STROKE_HALF,
+	};
+	return center;
+}
+
+// Moves an edge down by one row
+static inline void _inknit_step_stroke_edge(struct inknit_stroke_edge *edge) {
+	edge->x   += edge->step;
+	edge->rem -= edge->step_rem;
+	if (edge->rem < 0) {
+		edge->x   += 1;
+		edge->rem += edge->den;
+	}
+}
+
+void _inknit_get_stroke_offsets(
+	int32_t                    dx,
+	int32_t                    dy,
+	int32_t                    thickness,
+	struct inknit_stroke_point *across,
+	struct inknit_stroke_point *along
+);
+
+bool _inknit_get_stroke_miter(
+	struct inknit_stroke_point  outer1,
+	struct inknit_stroke_point  outer2,
+	struct inknit_stroke_point *miter
+);
+
+uint32_t _inknit_build_stroke_edges(
+	struct inknit_stroke_edge *INKNIT_RESTRICT        edges,
+	const struct inknit_stroke_point *INKNIT_RESTRICT points,
+	uint32_t                                          count,
+	int32_t                                           first_row
+);
@@ -27,12 +27,14 @@
 #define INKNIT_CURRENT_LAYOUT x1lsb
 #define INKNIT_CURRENT_ENDIAN le
 #define INKNIT_CURRENT_GROUP  INKNIT_INTERNAL_GROUP(32, 1, le)
+#define INKNIT_CURRENT_WORD   uint32_t
 
 #define PIXEL_LAYOUT    INKNIT_X1LSB
 #define IS_LITTLE       1
 #define BITS_PER_PIXEL  1
 #define PIXELS_PER_BYTE 8
 #define PIXELS_PER_WORD 32
+#define BITS_PER_WORD   32
 
 #define BITS_PER_WORD_NEG1       31    // BITS_PER_WORD - 1
 #define LOG2_BITS_PER_WORD       5     // log2(BITS_PER_WORD)
@@ -27,12 +27,14 @@
 #define INKNIT_CURRENT_LAYOUT x2
 #define INKNIT_CURRENT_ENDIAN be
 #define INKNIT_CURRENT_GROUP  INKNIT_INTERNAL_GROUP(32, 2, be)
+#define INKNIT_CURRENT_WORD   uint32_t
 
 #define PIXEL_LAYOUT    INKNIT_X2
 #define IS_LITTLE       0
 #define BITS_PER_PIXEL  2
 #define PIXELS_PER_BYTE 4
 #define PIXELS_PER_WORD 16
+#define BITS_PER_WORD   32
 
 #define BITS_PER_WORD_NEG1       31    // BITS_PER_WORD - 1
 #define LOG2_BITS_PER_WORD       5     // log2(BITS_PER_WORD)
@@ -25,22 +25,43 @@
 #include "../inc/inknit/x2.h"
 
 const struct inknit_exports x2 = {
-	.blit            = inknit_blit,
-	.clear           = inknit_clear,
-	.fill_circle     = inknit_fill_circle,
-	.fill_ellipse    = inknit_fill_ellipse,
-	.fill_rect       = inknit_fill_rect,
-	.fill_rect_coord = inknit_fill_rect_coord,
-	.draw_circle     = inknit_draw_circle,
-	.draw_ellipse    = inknit_draw_ellipse,
-	.draw_point      = inknit_draw_point,
-	.draw_hline      = inknit_draw_hline,
-	.draw_vline      = inknit_draw_vline,
-	.draw_line       = inknit_draw_line,
-	.draw_rect       = inknit_draw_rect,
-	.draw_rect_coord = inknit_draw_rect_coord,
-	.features        = INKNIT_FEATURE_PRIMITIVE | INKNIT_FEATURE_BLIT | INKNIT_FEATURE_DRAW,
-	.layout          = INKNIT_X2,
+	.blit                   = inknit_blit,
+	.blit_rop               = inknit_blit_rop,
+	.blit_convert           = inknit_blit_convert,
+	.blit_scaled            = inknit_blit_scaled,
+	.scroll                 = inknit_scroll,
+	.convert_order          = inknit_convert_order,
+	.convert_order_in_place = inknit_convert_order_in_place,
+	.clear                  = inknit_clear,
+	.fill_circle            = inknit_fill_circle,
+	.fill_circle_pattern    = inknit_fill_circle_pattern,
+	.fill_ellipse           = inknit_fill_ellipse,
+	.fill_polygon           = inknit_fill_polygon,
+	.fill_rect              = inknit_fill_rect,
+	.fill_rect_coord        = inknit_fill_rect_coord,
+	.fill_rect_pattern      = inknit_fill_rect_pattern,
+	.fill_ring              = inknit_fill_ring,
+	.fill_round_rect        = inknit_fill_round_rect,
+	.fill_sector            = inknit_fill_sector,
+	.fill_triangle          = inknit_fill_triangle,
+	.flood_fill             = inknit_flood_fill,
+	.draw_arc               = inknit_draw_arc,
+	.draw_circle            = inknit_draw_circle,
+	.draw_ellipse           = inknit_draw_ellipse,
+	.draw_point             = inknit_draw_point,
+	.draw_hline             = inknit_draw_hline,
+	.draw_vline             = inknit_draw_vline,
+	.draw_line              = inknit_draw_line,
+	.draw_lines             = inknit_draw_lines,
+	.draw_polyline          = inknit_draw_polyline,
+	.draw_rect              = inknit_draw_rect,
+	.draw_rect_coord        = inknit_draw_rect_coord,
+	.draw_round_rect        = inknit_draw_round_rect,
+	.draw_thick_line        = inknit_draw_thick_line,
+	.draw_thick_polyline    = inknit_draw_thick_polyline,
+	.features               = INKNIT_FEATURE_PRIMITIVE | INKNIT_FEATURE_BLIT | INKNIT_FEATURE_SCALE
+							| INKNIT_FEATURE_DRAW,
+	.layout                 = INKNIT_X2,
 };
 
 #endif
@@ -27,12 +27,14 @@
 #define INKNIT_CURRENT_LAYOUT x2lsb
 #define INKNIT_CURRENT_ENDIAN le
 #define INKNIT_CURRENT_GROUP  INKNIT_INTERNAL_GROUP(32, 2, le)
+#define INKNIT_CURRENT_WORD   uint32_t
 
 #define PIXEL_LAYOUT    INKNIT_X2LSB
 #define IS_LITTLE       1
 #define BITS_PER_PIXEL  2
 #define PIXELS_PER_BYTE 4
 #define PIXELS_PER_WORD 16
+#define BITS_PER_WORD   32
 
 #define BITS_PER_WORD_NEG1       31    // BITS_PER_WORD - 1
 #define LOG2_BITS_PER_WORD       5     // log2(BITS_PER_WORD)
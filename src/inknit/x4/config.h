@@ -27,12 +27,14 @@
 #define INKNIT_CURRENT_LAYOUT x4
 #define INKNIT_CURRENT_ENDIAN be
 #define INKNIT_CURRENT_GROUP  INKNIT_INTERNAL_GROUP(32, 4, be)
+#define INKNIT_CURRENT_WORD   uint32_t
 
 #define PIXEL_LAYOUT    INKNIT_X4
 #define IS_LITTLE       0
 #define BITS_PER_PIXEL  4
 #define PIXELS_PER_BYTE 2
 #define PIXELS_PER_WORD 8
+#define BITS_PER_WORD   32
 
 #define BITS_PER_WORD_NEG1       31    // BITS_PER_WORD - 1
 #define LOG2_BITS_PER_WORD       5     // log2(BITS_PER_WORD)
@@ -25,8 +25,6 @@
 #include "inknit/base.hpp"      // color_t, int_t, point_t, size_t, and each primitive type
 #include "inknit/drawable.hpp"  // drawable_image
 
-#define INKNIT_TARGET_BIT_WIDTH 32
-
 namespace inknit {
 
 template<
@@ -159,7 +157,7 @@ public:
 	}
 
 	static inline constexpr inknit::alignment alignment() noexcept {
-		return inknit::alignment::align32;
+		return details::align(INKNIT_TARGET_BIT_WIDTH);
 	}
 	static inline constexpr std::int32_t height() noexcept {
 		return HEIGHT;
@@ -172,7 +170,7 @@ public:
 	}
 
 protected:
-	std::uint32_t buffer_[SIZE / 4];
+	alignas(INKNIT_TARGET_BIT_WIDTH / 8) std::uint32_t buffer_[SIZE / 4];
 };
 
 }  // namespace inknit
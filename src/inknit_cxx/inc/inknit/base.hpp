@@ -66,6 +66,26 @@ enum class pixel_format : std::uint8_t {
 	abgr      = INKNIT_ABGR,
 };
 
+enum class raster_op : std::uint8_t {
+	copy   = INKNIT_ROP_COPY,
+	and_   = INKNIT_ROP_AND,
+	or_    = INKNIT_ROP_OR,
+	xor_   = INKNIT_ROP_XOR,
+	andnot = INKNIT_ROP_ANDNOT,
+	key    = INKNIT_ROP_KEY,
+};
+
+enum class fill_rule : std::uint8_t {
+	even_odd = INKNIT_FILL_EVEN_ODD,
+	nonzero  = INKNIT_FILL_NONZERO,
+};
+
+enum class line_join : std::uint8_t {
+	miter = INKNIT_JOIN_MITER,
+	round = INKNIT_JOIN_ROUND,
+	bevel = INKNIT_JOIN_BEVEL,
+};
+
 enum class colorrange : std::uint8_t {
 	full    = INKNIT_COLORRANGE_FULL,
 	limited = INKNIT_COLORRANGE_LIMITED,
@@ -19,7 +19,11 @@
 
 #pragma once
 
+#include <span>  // span
+
 #include "base.hpp"
+#include "inknit/corner.h"   // inknit_make_round_corner
+#include "inknit/pattern.h"  // inknit_make_dither_pattern
 
 namespace inknit { namespace details {
 
@@ -89,44 +93,70 @@ namespace inknit { namespace details {
 
 #include "inknit/prefix.h"
 
-// Pixel Layout: x1 (32-bit width/align, 1-bpp, BE)
-#define INKNIT_CURRENT_LAYOUT x1
-#define INKNIT_CURRENT_BPP    1
+#ifndef INKNIT_TARGET_BIT_WIDTH
+#ifdef INKNIT_ENABLE_WORD64
+#define INKNIT_TARGET_BIT_WIDTH 64
+#else
+#define INKNIT_TARGET_BIT_WIDTH 32
+#endif
+#endif
+
+#if INKNIT_TARGET_BIT_WIDTH == 64
+#define INKNIT_TARGET_LAYOUT(layout) _INKNIT_CONCAT2(layout, _64)
+#else
+#define INKNIT_TARGET_LAYOUT(layout) layout
+#endif
+
+// Pixel Layout: x1 (32/64-bit width/align, 1-bpp, BE)
+#define INKNIT_CURRENT_PIXEL_LAYOUT x1
+#define INKNIT_CURRENT_LAYOUT       INKNIT_TARGET_LAYOUT(x1)
+#define INKNIT_CURRENT_BPP          1
 #include "drawable.hpp.in"
+#undef INKNIT_CURRENT_PIXEL_LAYOUT
 #undef INKNIT_CURRENT_LAYOUT
 #undef INKNIT_CURRENT_BPP
 
-// Pixel Layout: x1lsb (32-bit width/align, 1-bpp, LE)
-#define INKNIT_CURRENT_LAYOUT x1lsb
-#define INKNIT_CURRENT_BPP    1
+// Pixel Layout: x1lsb (32/64-bit width/align, 1-bpp, LE)
+#define INKNIT_CURRENT_PIXEL_LAYOUT x1lsb
+#define INKNIT_CURRENT_LAYOUT       INKNIT_TARGET_LAYOUT(x1lsb)
+#define INKNIT_CURRENT_BPP          1
 #include "drawable.hpp.in"
+#undef INKNIT_CURRENT_PIXEL_LAYOUT
 #undef INKNIT_CURRENT_LAYOUT
 #undef INKNIT_CURRENT_BPP
 
-// Pixel Layout: x2 (32-bit width/align, 2-bpp, BE)
-#define INKNIT_CURRENT_LAYOUT x2
-#define INKNIT_CURRENT_BPP    2
+// Pixel Layout: x2 (32/64-bit width/align, 2-bpp, BE)
+#define INKNIT_CURRENT_PIXEL_LAYOUT x2
+#define INKNIT_CURRENT_LAYOUT       INKNIT_TARGET_LAYOUT(x2)
+#define INKNIT_CURRENT_BPP          2
 #include "drawable.hpp.in"
+#undef INKNIT_CURRENT_PIXEL_LAYOUT
 #undef INKNIT_CURRENT_LAYOUT
 #undef INKNIT_CURRENT_BPP
 
-// Pixel Layout: x2lsb (32-bit width/align, 2-bpp, LE)
-#define INKNIT_CURRENT_LAYOUT x2lsb
-#define INKNIT_CURRENT_BPP    2
+// Pixel Layout: x2lsb (32/64-bit width/align, 2-bpp, LE)
+#define INKNIT_CURRENT_PIXEL_LAYOUT x2lsb
+#define INKNIT_CURRENT_LAYOUT       INKNIT_TARGET_LAYOUT(x2lsb)
+#define INKNIT_CURRENT_BPP          2
 #include "drawable.hpp.in"
+#undef INKNIT_CURRENT_PIXEL_LAYOUT
 #undef INKNIT_CURRENT_LAYOUT
 #undef INKNIT_CURRENT_BPP
 
-// Pixel Layout: x4 (32-bit width/align, 4-bpp, BE)
-#define INKNIT_CURRENT_LAYOUT x4
-#define INKNIT_CURRENT_BPP    4
+// Pixel Layout: x4 (32/64-bit width/align, 4-bpp, BE)
+#define INKNIT_CURRENT_PIXEL_LAYOUT x4
+#define INKNIT_CURRENT_LAYOUT       INKNIT_TARGET_LAYOUT(x4)
+#define INKNIT_CURRENT_BPP          4
 #include "drawable.hpp.in"
+#undef INKNIT_CURRENT_PIXEL_LAYOUT
 #undef INKNIT_CURRENT_LAYOUT
 #undef INKNIT_CURRENT_BPP
 
-// Pixel Layout: x4lsb (32-bit width/align, 4-bpp, LE)
-#define INKNIT_CURRENT_LAYOUT x4lsb
-#define INKNIT_CURRENT_BPP    4
+// Pixel Layout: x4lsb (32/64-bit width/align, 4-bpp, LE)
+#define INKNIT_CURRENT_PIXEL_LAYOUT x4lsb
+#define INKNIT_CURRENT_LAYOUT       INKNIT_TARGET_LAYOUT(x4lsb)
+#define INKNIT_CURRENT_BPP          4
 #include "drawable.hpp.in"
+#undef INKNIT_CURRENT_PIXEL_LAYOUT
 #undef INKNIT_CURRENT_LAYOUT
 #undef INKNIT_CURRENT_BPP
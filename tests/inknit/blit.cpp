@@ -46,6 +46,139 @@ void subtest_blit(
 	dst.test(bind_is_pixel_on_rect({dx, dy}, {width, height}));
 }
 
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_blit_stripes(
+	Image&       dst,
+	std::int32_t dx,
+	std::int32_t dy,
+	Image&       src,
+	std::int32_t sx,
+	std::int32_t sy,
+	std::int32_t width,
+	std::int32_t height
+) noexcept {
+	// Every third source column is white, so any shift of the copied bits changes the result.
+	src.clear(colors::black);
+	for (std::int32_t x = 0; x < src.width(); x += 3) {
+		src.draw_vline(x, 0, src.height() - 1, colors::white);
+	}
+
+	dst.clear(colors::black);
+	dst.blit(dx, dy, src, sx, sy, width, height);
+	dst.test([=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		if (x < dx || x >= dx + width || y < dy || y >= dy + height) {
+			return colors::black;
+		}
+		return (x - dx + sx) % 3 == 0 ? colors::white : colors::black;
+	});
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_blit_rop(
+	Image&       dst,
+	std::int32_t dx,
+	std::int32_t dy,
+	Image&       src,
+	std::int32_t sx,
+	std::int32_t sy,
+	std::int32_t width,
+	std::int32_t height,
+	raster_op    rop,
+	color_t      key
+) noexcept {
+	// Every color appears in both images at shifting offsets, so each pixel pair is exercised.
+	color_t const max = (1u << Image::bpp) - 1;
+	auto const src_color = [=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		return static_cast<color_t>(x + 2 * y) & max;
+	};
+	auto const dst_color = [=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		return static_cast<color_t>(3 * x + y + 1) & max;
+	};
+	for (std::int32_t y = 0; y < src.height(); ++y) {
+		for (std::int32_t x = 0; x < src.width(); ++x) {
+			src.draw_point(x, y, src_color(x, y));
+		}
+	}
+	for (std::int32_t y = 0; y < dst.height(); ++y) {
+		for (std::int32_t x = 0; x < dst.width(); ++x) {
+			dst.draw_point(x, y, dst_color(x, y));
+		}
+	}
+
+	dst.blit_rop(dx, dy, src, sx, sy, width, height, rop, key);
+	dst.test([=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		color_t const d = dst_color(x, y);
+		if (x < dx || x >= dx + width || y < dy || y >= dy + height) {
+			return d;
+		}
+
+		color_t const s = src_color(x - dx + sx, y - dy + sy);
+		switch (rop) {
+		case raster_op::and_:
+			return d & s;
+		case raster_op::or_:
+			return d | s;
+		case raster_op::xor_:
+			return d ^ s;
+		case raster_op::andnot:
+			return d & ~s & max;
+		case raster_op::key:
+			return s == key ? d : s;
+		case raster_op::copy:
+		default:
+			return s;
+		}
+	});
+}
+
+template<typename Image, typename Source>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+		  && std::convertible_to<Source, inknit::details::image_primitive>
+void subtest_blit_convert(
+	Image&         dst,
+	std::int32_t   dx,
+	std::int32_t   dy,
+	Source&        src,
+	std::int32_t   sx,
+	std::int32_t   sy,
+	std::int32_t   width,
+	std::int32_t   height,
+	color_t const* palette
+) noexcept {
+	color_t const src_max   = (1u << Source::bpp) - 1;
+	auto const    src_color = [=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		return static_cast<color_t>(x + 2 * y) & src_max;
+	};
+	for (std::int32_t y = 0; y < src.height(); ++y) {
+		for (std::int32_t x = 0; x < src.width(); ++x) {
+			src.draw_point(x, y, src_color(x, y));
+		}
+	}
+
+	dst.clear(colors::black);
+	dst.blit_convert(dx, dy, src, sx, sy, width, height, palette);
+	dst.test([=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		if (x < dx || x >= dx + width || y < dy || y >= dy + height) {
+			return colors::black;
+		}
+
+		color_t color = src_color(x - dx + sx, y - dy + sy);
+		if (palette != nullptr) {
+			return palette[color];
+		}
+		if constexpr (Source::bpp >= Image::bpp) {
+			return color >> (Source::bpp - Image::bpp);
+		} else {
+			for (std::int32_t bits = Source::bpp; bits < Image::bpp; bits <<= 1) {
+				color |= color << bits;
+			}
+			return color;
+		}
+	});
+}
+
 }  // namespace inknit::tests::shared
 
 using namespace inknit;
@@ -152,11 +285,128 @@ TEST_CASE_TEMPLATE(
 	SUBCASE_INVOKE(10, 8, dw, dh, 8, 10, sw, sh, 16, 16, "overlap: right-up");
 	SUBCASE_INVOKE(8, 10, dw, dh, 10, 8, sw, sh, 16, 16, "overlap: left-down");
 
+	// 9. content
+	// Non-uniform source to verify bit offsets, including long stitched rows.
+	SUBCASE("content: unaligned src to unaligned dst") {
+		shared::subtest_blit_stripes(dst, 3, 5, src, 5, 5, ppw * 2, 4);
+	}
+	SUBCASE("content: unaligned src to aligned dst, long row") {
+		shared::subtest_blit_stripes(dst, 0, 5, src, 1, 5, sw - ppw, 4);
+	}
+	SUBCASE("content: aligned src to unaligned dst, long row") {
+		shared::subtest_blit_stripes(dst, ppw - 1, 5, src, 0, 5, sw - ppw, 4);
+	}
+
 	// clang-format on
 
 #undef SUBCASE_INVOKE
 }
 
+TEST_CASE_TEMPLATE(
+	"blit_rop",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image src, dst;
+	src.reset(4 * src.ppw, 8);
+	dst.reset(4 * dst.ppw, 8);
+
+	std::int32_t const ppw = src.ppw;
+	color_t const      key = (1u << Image::bpp) - 1;
+
+	raster_op const rops[] = {
+		raster_op::copy,
+		raster_op::and_,
+		raster_op::or_,
+		raster_op::xor_,
+		raster_op::andnot,
+		raster_op::key,
+	};
+	// clang-format off
+	SUBCASE("rop: aligned") {
+		for (raster_op const rop : rops) {
+			shared::subtest_blit_rop(dst, ppw, 1, src, 0, 2, 2 * ppw, 4, rop, key);
+		}
+	}
+	SUBCASE("rop: unaligned src to unaligned dst") {
+		for (raster_op const rop : rops) {
+			shared::subtest_blit_rop(dst, 3, 1, src, 5, 2, 2 * ppw + 1, 4, rop, key);
+		}
+	}
+	SUBCASE("rop: unaligned src to aligned dst") {
+		for (raster_op const rop : rops) {
+			shared::subtest_blit_rop(dst, 0, 1, src, 1, 2, 3 * ppw, 4, rop, key);
+		}
+	}
+	SUBCASE("rop: within one word") {
+		for (raster_op const rop : rops) {
+			shared::subtest_blit_rop(dst, 1, 1, src, 2, 2, ppw / 2, 4, rop, key);
+		}
+	}
+	// clang-format on
+}
+
+TEST_CASE_TEMPLATE(
+	"blit_convert",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image dst;
+
+	test_image<pixel_layout::x1, pixel_format::grayscale>    src_x1;
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale> src_x1lsb;
+	test_image<pixel_layout::x2, pixel_format::grayscale>    src_x2;
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale> src_x4lsb;
+
+	// Arbitrary mapping covering every source depth
+	color_t const max       = (1u << Image::bpp) - 1;
+	color_t const palette[] = {
+		max, max - 1, max / 2, 0, max, 0, max, 0, max, 0, max, 0, max, 0, max, 0,
+	};
+
+	// The images are large enough for the LUT path; the small blits take the per-pixel path.
+	dst.reset(128, 40);
+	src_x1.reset(128, 40);
+	src_x1lsb.reset(128, 40);
+	src_x2.reset(128, 40);
+	src_x4lsb.reset(128, 40);
+
+	// clang-format off
+	SUBCASE("convert: small, unaligned") {
+		shared::subtest_blit_convert(dst, 3, 1, src_x1, 5, 2, 21, 4, nullptr);
+		shared::subtest_blit_convert(dst, 3, 1, src_x1lsb, 5, 2, 21, 4, nullptr);
+		shared::subtest_blit_convert(dst, 3, 1, src_x2, 5, 2, 21, 4, nullptr);
+		shared::subtest_blit_convert(dst, 3, 1, src_x4lsb, 5, 2, 21, 4, nullptr);
+	}
+	SUBCASE("convert: large, unaligned") {
+		shared::subtest_blit_convert(dst, 5, 2, src_x1, 3, 1, 120, 36, nullptr);
+		shared::subtest_blit_convert(dst, 5, 2, src_x1lsb, 3, 1, 120, 36, nullptr);
+		shared::subtest_blit_convert(dst, 5, 2, src_x2, 3, 1, 120, 36, nullptr);
+		shared::subtest_blit_convert(dst, 5, 2, src_x4lsb, 3, 1, 120, 36, nullptr);
+	}
+	SUBCASE("convert: large, aligned") {
+		shared::subtest_blit_convert(dst, 0, 0, src_x1, 0, 0, 128, 40, nullptr);
+		shared::subtest_blit_convert(dst, 0, 0, src_x4lsb, 0, 0, 128, 40, nullptr);
+	}
+	SUBCASE("convert: palette") {
+		shared::subtest_blit_convert(dst, 3, 1, src_x1, 5, 2, 21, 4, palette);
+		shared::subtest_blit_convert(dst, 5, 2, src_x1, 3, 1, 120, 36, palette);
+		shared::subtest_blit_convert(dst, 5, 2, src_x2, 3, 1, 120, 36, palette);
+		shared::subtest_blit_convert(dst, 5, 2, src_x4lsb, 3, 1, 120, 36, palette);
+	}
+	// clang-format on
+}
+
 TEST_CASE_TEMPLATE(
 	"blit_old",
 	Image,
@@ -0,0 +1,94 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+struct twin_image;
+
+template<pixel_layout PIXEL_LAYOUT, pixel_format PIXEL_FORMAT>
+struct twin_image<test_image<PIXEL_LAYOUT, PIXEL_FORMAT>> {
+	// x1 <-> x1lsb, x2 <-> x2lsb, x4 <-> x4lsb
+	static constexpr pixel_layout layout = static_cast<pixel_layout>(
+		static_cast<std::uint8_t>(PIXEL_LAYOUT)
+		^ static_cast<std::uint8_t>(pixel_layout::x1)
+		^ static_cast<std::uint8_t>(pixel_layout::x1lsb)
+	);
+
+	using type = test_image<layout, PIXEL_FORMAT>;
+};
+
+template<typename Image>
+static constexpr color_t convert_order_pattern(std::int32_t x, std::int32_t y) noexcept {
+	// Neighboring pixels always differ, so any pixel order mistake changes the result.
+	return static_cast<color_t>(3 * x + y) & ((1u << Image::bpp) - 1);
+}
+
+template<typename Image, typename Source>
+void subtest_convert_order(Image& image, Source& src, std::int32_t width, std::int32_t height) {
+	src.reset(width, height);
+	for (std::int32_t y = 0; y < height; ++y) {
+		for (std::int32_t x = 0; x < width; ++x) {
+			src.draw_point(x, y, convert_order_pattern<Image>(x, y));
+		}
+	}
+
+	image.reset(width, height);
+	image.clear(colors::black);
+	image.convert_order(src);
+	image.test(convert_order_pattern<Image>);
+
+	// In place: converting back restores the source
+	image.convert_order_in_place();
+	src.convert_order_in_place();
+	src.convert_order_in_place();
+	src.test(convert_order_pattern<Image>);
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"convert_order",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image                                    image;
+	typename shared::twin_image<Image>::type src;
+
+	std::int32_t const ppw = image.ppw;
+
+	SUBCASE("one word") {
+		shared::subtest_convert_order(image, src, ppw, 3);
+	}
+	SUBCASE("unaligned width") {
+		shared::subtest_convert_order(image, src, 3 * ppw + 5, 7);
+	}
+	SUBCASE("large") {
+		shared::subtest_convert_order(image, src, 16 * ppw + 3, 24);
+	}
+}
@@ -90,6 +90,8 @@ TEST_CASE_TEMPLATE(
 
 	// 5. large
 	SUBCASE_INVOKE(width / 2, height / 2, minlen / 2, "large: inscribed circle");
+	SUBCASE_INVOKE(width / 2, height / 2, 2 * minlen / 3, "large: clipped on all sides");
+	SUBCASE_INVOKE(width / 3, -minlen / 4, minlen, "large: center above the image");
 
 	// 6. full coverage
 	SUBCASE_INVOKE(width / 2, height / 2, maxlen, "full coverage: fills entire image");
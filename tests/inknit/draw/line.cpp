@@ -106,6 +106,26 @@ TEST_CASE_TEMPLATE(
 	SUBCASE_INVOKE(-2048, -2048, 2047, 2047, "robust: max coordinate range");
 	SUBCASE_INVOKE(2047, -2048, -2048, 2047, "robust: max coordinate range, opposite");
 
+	// 6. long runs
+	// Runs longer than a byte or a word on the major axis.
+	SUBCASE_INVOKE(1, 2, right - 1, 5, "runs: shallow, right-down");
+	SUBCASE_INVOKE(right - 1, 5, 1, 2, "runs: shallow, left-up");
+	SUBCASE_INVOKE(1, 6, right - 2, 1, "runs: shallow, right-up");
+	SUBCASE_INVOKE(2, 1, 5, bottom - 1, "runs: steep, right-down");
+	SUBCASE_INVOKE(6, 1, 1, bottom - 2, "runs: steep, left-down");
+
+	// 7. clip
+	// Clipped lines must keep the pixels of the unclipped line, whichever endpoint is outside.
+	SUBCASE_INVOKE(-7, 3, right + 9, 11, "clip: shallow, both ends outside");
+	SUBCASE_INVOKE(right + 5, -3, -6, bottom - 2, "clip: shallow, right-to-left");
+	SUBCASE_INVOKE(-13, -5, 9, bottom + 6, "clip: steep, both ends outside");
+	SUBCASE_INVOKE(3, bottom + 17, 11, -9, "clip: steep, bottom-to-top");
+	SUBCASE_INVOKE(-1000, 1, 5, 7, "clip: mostly outside, left");
+	SUBCASE_INVOKE(4, 2, 9, -1000, "clip: mostly outside, top");
+	SUBCASE_INVOKE(-2048, -1017, 2047, 2001, "clip: long shallow line");
+	SUBCASE_INVOKE(-5, 20, 20, -5, "clip: corner to corner");
+	SUBCASE_INVOKE(-9, bottom + 3, right + 2, bottom + 1, "clip: misses the image");
+
 #undef SUBCASE_INVOKE
 
 	SUBCASE("single-column") {
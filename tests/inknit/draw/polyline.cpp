@@ -0,0 +1,150 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit_test.hpp"
+
+#include <vector>
+
+namespace inknit::tests::shared {
+
+// Both batch calls must match drawing every segment on its own with draw_line.
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_draw_polyline(Image& image, std::vector<inknit_point> const& points) noexcept {
+	Image expected;
+	expected.reset(image.width(), image.height());
+	expected.clear(colors::black);
+	if (points.size() == 1) {
+		expected.draw_line({points[0].x, points[0].y}, {points[0].x, points[0].y}, colors::white);
+	}
+	for (std::size_t i = 1; i < points.size(); ++i) {
+		inknit_point const& p1 = points[i - 1];
+		inknit_point const& p2 = points[i];
+		expected.draw_line({p1.x, p1.y}, {p2.x, p2.y}, colors::white);
+	}
+
+	image.clear(colors::black);
+	image.draw_polyline(points, colors::white);
+	image.test([&expected](std::int32_t x, std::int32_t y) { return expected.at(x, y); });
+
+	// The same path as a chain of segments; a single point becomes a zero-length segment
+	std::vector<inknit_segment> segments;
+	if (points.size() == 1) {
+		segments.push_back({points[0], points[0]});
+	}
+	for (std::size_t i = 1; i < points.size(); ++i) {
+		segments.push_back({points[i - 1], points[i]});
+	}
+
+	image.clear(colors::black);
+	image.draw_lines(segments, colors::white);
+	image.test([&expected](std::int32_t x, std::int32_t y) { return expected.at(x, y); });
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_draw_lines(Image& image, std::vector<inknit_segment> const& segments) noexcept {
+	Image expected;
+	expected.reset(image.width(), image.height());
+	expected.clear(colors::black);
+	for (inknit_segment const& segment : segments) {
+		expected.draw_line(
+			{segment.start.x, segment.start.y}, {segment.end.x, segment.end.y}, colors::white
+		);
+	}
+
+	image.clear(colors::black);
+	image.draw_lines(segments, colors::white);
+	image.test([&expected](std::int32_t x, std::int32_t y) { return expected.at(x, y); });
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"draw_polyline",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...) \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_draw_polyline(image, {__VA_ARGS__}), _MSG)
+
+	auto const inner_right  = static_cast<std::int16_t>(image.width() - 2);
+	auto const inner_bottom = static_cast<std::int16_t>(image.height() - 2);
+	auto const outer_right  = static_cast<std::int16_t>(image.width() + 8);
+	auto const outer_bottom = static_cast<std::int16_t>(image.height() + 8);
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: single point", {3, 3});
+	SUBCASE_INVOKE("basic: single segment", {2, 2}, {10, 4});
+	SUBCASE_INVOKE("basic: open rectangle", {2, 2}, {12, 2}, {12, 9}, {2, 9}, {2, 3});
+	SUBCASE_INVOKE("basic: closed triangle", {3, 1}, {14, 6}, {1, 12}, {3, 1});
+	SUBCASE_INVOKE("basic: zigzag", {0, 8}, {3, 2}, {6, 12}, {9, 1}, {12, 14}, {15, 8});
+
+	// 2. degenerate
+	SUBCASE_INVOKE("degenerate: repeated vertex", {2, 2}, {8, 5}, {8, 5}, {8, 5}, {1, 12});
+	SUBCASE_INVOKE("degenerate: backtracking", {2, 6}, {12, 8}, {2, 6}, {12, 8});
+
+	// 3. long runs
+	SUBCASE_INVOKE("runs: shallow and steep", {1, 2}, {inner_right, 5}, {6, inner_bottom}, {1, 2});
+	SUBCASE_INVOKE("runs: reversed", {inner_right, 5}, {1, 2}, {5, inner_bottom}, {6, 1});
+
+	// 4. clip
+	SUBCASE_INVOKE("clip: leaves and re-enters", {2, 2}, {-10, 8}, {outer_right, 12}, {3, 9});
+	SUBCASE_INVOKE("clip: vertex outside", {-5, -5}, {6, 6}, {outer_right, -5});
+	SUBCASE_INVOKE("clip: all outside", {-5, -5}, {outer_right, -3}, {outer_right, outer_bottom});
+	SUBCASE_INVOKE("clip: max coordinate range", {-2048, -2048}, {2047, 2047}, {2047, -2048});
+
+#undef SUBCASE_INVOKE
+}
+
+TEST_CASE_TEMPLATE(
+	"draw_lines",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...) \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_draw_lines(image, {__VA_ARGS__}), _MSG)
+
+	// Segments that are not connected to each other, or only partly
+	SUBCASE_INVOKE("disjoint", {{1, 1}, {9, 3}}, {{12, 2}, {4, 13}}, {{0, 15}, {15, 15}});
+	SUBCASE_INVOKE("shared start", {{8, 8}, {1, 1}}, {{8, 8}, {14, 3}}, {{8, 8}, {8, 15}});
+	SUBCASE_INVOKE("chain after gap", {{1, 1}, {5, 9}}, {{5, 9}, {13, 2}}, {{2, 14}, {13, 12}});
+	SUBCASE_INVOKE("clipped chain", {{-4, 3}, {6, 6}}, {{6, 6}, {20, 9}}, {{20, 9}, {3, 14}});
+
+#undef SUBCASE_INVOKE
+}
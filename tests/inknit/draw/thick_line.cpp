@@ -0,0 +1,185 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_draw_thick_line(
+	Image& image, point_t pt1, point_t pt2, std::int32_t thickness, bool skip_test = false
+) noexcept {
+	image.clear(colors::black);
+	image.draw_thick_line(pt1, pt2, thickness, colors::white);
+
+	if (!skip_test) {
+		auto [x1, y1] = pt1;
+		auto [x2, y2] = pt2;
+		std::vector<inknit_point> const points = {
+			{static_cast<std::int16_t>(x1), static_cast<std::int16_t>(y1)},
+			{static_cast<std::int16_t>(x2), static_cast<std::int16_t>(y2)},
+		};
+		image.test(bind_is_pixel_on_thick_polyline(points, thickness, line_join::miter));
+	}
+}
+
+// An upright line of odd thickness is a rect that covers both end pixels
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_draw_thick_line_as_rect(
+	Image& image, point_t pt1, point_t pt2, std::int32_t thickness, point_t ipt, size_t isz
+) noexcept {
+	image.clear(colors::black);
+	image.draw_thick_line(pt1, pt2, thickness, colors::white);
+	image.test(bind_is_pixel_on_rect(ipt, isz));
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_draw_thick_polyline(
+	Image&                           image,
+	std::int32_t                     thickness,
+	line_join                        join,
+	std::vector<inknit_point> const& points,
+	bool                             skip_test = false
+) noexcept {
+	image.clear(colors::black);
+	image.draw_thick_polyline(points, thickness, join, colors::white);
+
+	if (!skip_test) {
+		image.test(bind_is_pixel_on_thick_polyline(points, thickness, join));
+	}
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"draw_thick_line",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...)                                                    \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_draw_thick_line(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_INVOKE_RECT(_MSG, ...)                                                       \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_draw_thick_line_as_rect(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_EXPECT_ASSERT(_MSG, _EXPECTED_MESSAGE, ...)                                \
+	INKNIT_SUBCASE_EXPECT_ASSERT(                                                          \
+		shared::subtest_draw_thick_line(image, __VA_ARGS__, true), _MSG, _EXPECTED_MESSAGE \
+	)
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: shallow", {2, 3}, {28, 11}, 3);
+	SUBCASE_INVOKE("basic: steep", {5, 1}, {12, 29}, 4);
+	SUBCASE_INVOKE("basic: diagonal", {3, 3}, {26, 26}, 5);
+	SUBCASE_INVOKE("basic: reversed", {26, 20}, {4, 6}, 6);
+	SUBCASE_INVOKE("basic: thin", {1, 2}, {29, 17}, 1);
+	SUBCASE_INVOKE("basic: thick and short", {14, 14}, {17, 15}, 12);
+
+	// 2. rect
+	SUBCASE_INVOKE_RECT("rect: horizontal", {4, 10}, {20, 10}, 3, {4, 9}, {17, 3});
+	SUBCASE_INVOKE_RECT("rect: vertical", {8, 2}, {8, 25}, 5, {6, 2}, {5, 24});
+	SUBCASE_INVOKE_RECT("rect: thin", {3, 7}, {21, 7}, 1, {3, 7}, {19, 1});
+	SUBCASE_INVOKE_RECT("rect: point", {9, 9}, {9, 9}, 5, {7, 7}, {5, 5});
+
+	// 3. clip
+	SUBCASE_INVOKE("clip: left top", {-6, -3}, {14, 10}, 4);
+	SUBCASE_INVOKE("clip: right bottom", {width - 8, height - 9}, {width + 6, height + 2}, 5);
+	SUBCASE_INVOKE("clip: crosses the image", {-10, height / 2}, {width + 10, height / 3}, 7);
+	SUBCASE_INVOKE("clip: outside", {-20, 5}, {-8, 20}, 6);
+	SUBCASE_INVOKE("clip: max coordinate range", {-2048, -2048}, {2047, 2047}, 9);
+
+	// 4. robust
+	SUBCASE_EXPECT_ASSERT("robust: zero thickness", "ERROR: thickness < 1", {2, 2}, {9, 9}, 0);
+	SUBCASE_EXPECT_ASSERT(
+		"robust: too thick", "ERROR: thickness > 2^8 - 1", {2, 2}, {9, 9}, 256
+	);
+
+#undef SUBCASE_INVOKE
+#undef SUBCASE_INVOKE_RECT
+#undef SUBCASE_EXPECT_ASSERT
+}
+
+TEST_CASE_TEMPLATE(
+	"draw_thick_polyline",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, _THICKNESS, ...)                                                      \
+	SUBCASE(_MSG " (miter)") {                                                                     \
+		shared::subtest_draw_thick_polyline(image, _THICKNESS, line_join::miter, {__VA_ARGS__}); \
+	}                                                                                              \
+	SUBCASE(_MSG " (round)") {                                                                     \
+		shared::subtest_draw_thick_polyline(image, _THICKNESS, line_join::round, {__VA_ARGS__}); \
+	}                                                                                              \
+	SUBCASE(_MSG " (bevel)") {                                                                     \
+		shared::subtest_draw_thick_polyline(image, _THICKNESS, line_join::bevel, {__VA_ARGS__}); \
+	}
+
+	auto const outer_right  = static_cast<std::int16_t>(image.width() + 8);
+	auto const outer_bottom = static_cast<std::int16_t>(image.height() + 8);
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: right angle", 5, {4, 4}, {24, 4}, {24, 26});
+	SUBCASE_INVOKE("basic: counter-clockwise", 4, {4, 26}, {24, 26}, {24, 4});
+	SUBCASE_INVOKE("basic: obtuse", 6, {2, 20}, {14, 8}, {29, 12});
+	SUBCASE_INVOKE("basic: acute", 5, {3, 4}, {27, 14}, {5, 22});
+	SUBCASE_INVOKE("basic: sharp", 3, {3, 5}, {28, 9}, {3, 12});
+	SUBCASE_INVOKE("basic: zigzag", 3, {1, 25}, {8, 5}, {15, 25}, {22, 5}, {29, 25});
+	SUBCASE_INVOKE("basic: closed", 4, {5, 5}, {25, 5}, {25, 25}, {5, 25}, {5, 5});
+	SUBCASE_INVOKE("basic: thin", 1, {2, 2}, {20, 9}, {9, 27});
+
+	// 2. degenerate
+	SUBCASE_INVOKE("degenerate: no points", 3, );
+	SUBCASE_INVOKE("degenerate: single point", 4, {10, 10});
+	SUBCASE_INVOKE("degenerate: repeated point", 5, {10, 10}, {10, 10}, {10, 10});
+	SUBCASE_INVOKE("degenerate: repeated vertex", 5, {3, 3}, {15, 9}, {15, 9}, {6, 26});
+	SUBCASE_INVOKE("degenerate: straight", 4, {3, 3}, {12, 9}, {21, 15});
+	SUBCASE_INVOKE("degenerate: reversal", 5, {4, 12}, {24, 12}, {10, 12});
+
+	// 3. clip
+	SUBCASE_INVOKE("clip: all sides", 6, {-6, 4}, {8, -9}, {outer_right, 6}, {9, outer_bottom});
+	SUBCASE_INVOKE("clip: joins outside", 5, {-4, 10}, {-2, outer_bottom}, {outer_right, 12});
+	SUBCASE_INVOKE("clip: max coordinate range", 7, {-2048, -2048}, {2047, 20}, {-2048, 2047});
+
+#undef SUBCASE_INVOKE
+}
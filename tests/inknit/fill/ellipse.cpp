@@ -97,6 +97,8 @@ TEST_CASE_TEMPLATE(
 
 	// 5. large
 	SUBCASE_INVOKE(width / 2, height / 2, minlen / 2, minlen / 3, "large: inscribed ellipse");
+	SUBCASE_INVOKE(width / 2, height / 2, width, height / 4, "large: flat, clipped on the sides");
+	SUBCASE_INVOKE(width / 3, height / 2, width / 5, height, "large: tall, clipped top and bottom");
 
 	// 6. full coverage
 	SUBCASE_INVOKE(width / 2, height / 2, maxlen, maxlen, "full coverage: fills entire image");
@@ -0,0 +1,231 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <deque>   // deque
+#include <vector>  // vector
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+enum class flood_scene {
+	empty,    // nothing drawn
+	box,      // a rect outline
+	circles,  // two overlapping circle outlines
+	comb,     // teeth from the top and bottom in turn, so the region winds back and forth
+	noise,    // scattered pixels over a quarter of the image, leaving its center clear
+};
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void draw_flood_scene(Image& image, flood_scene scene) noexcept {
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	image.clear(colors::black);
+	switch (scene) {
+	case flood_scene::empty:
+		break;
+	case flood_scene::box:
+		image.draw_rect({3, 2}, {width - 7, height - 5}, colors::white);
+		break;
+	case flood_scene::circles:
+		image.draw_circle({width / 3, height / 2}, width / 4, colors::white);
+		image.draw_circle({width / 2, height / 2}, width / 4, colors::white);
+		break;
+	case flood_scene::comb:
+		for (std::int32_t x = 2, i = 0; x < width; x += 3, ++i) {
+			if ((i & 1) == 0) {
+				image.draw_vline(x, 0, height - 3, colors::white);
+			} else {
+				image.draw_vline(x, 2, height - 1, colors::white);
+			}
+		}
+		break;
+	case flood_scene::noise: {
+		std::uint32_t seed = 0x2545F491u;
+		for (std::int32_t y = 0; y < height; ++y) {
+			for (std::int32_t x = 0; x < width; ++x) {
+				seed = seed * 1664525u + 1013904223u;
+				if ((seed >> 24) < 64 && (x != width / 2 || y != height / 2)) {
+					image.draw_point(x, y, colors::white);
+				}
+			}
+		}
+		break;
+	}
+	}
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+std::vector<color_t> copy_pixels(Image const& image) noexcept {
+	std::vector<color_t> pixels;
+	for (std::int32_t y = 0; y < image.height(); ++y) {
+		for (std::int32_t x = 0; x < image.width(); ++x) {
+			pixels.push_back(image.at(x, y));
+		}
+	}
+	return pixels;
+}
+
+// Marks the 4-connected region of the seed color, reading the image before the fill
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+std::vector<bool> make_flood_region(Image const& image, std::int32_t x, std::int32_t y) noexcept {
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	std::vector<bool> region(static_cast<std::size_t>(width * height), false);
+	if (x < 0 || width <= x || y < 0 || height <= y) {
+		return region;
+	}
+
+	color_t const old = image.at(x, y);
+
+	std::deque<std::pair<std::int32_t, std::int32_t>> queue {{x, y}};
+	region[static_cast<std::size_t>(y * width + x)] = true;
+	while (!queue.empty()) {
+		auto const [px, py] = queue.front();
+		queue.pop_front();
+
+		std::pair<std::int32_t, std::int32_t> const neighbors[] = {
+			{px - 1, py},
+			{px + 1, py},
+			{px, py - 1},
+			{px, py + 1},
+		};
+		for (auto const [nx, ny] : neighbors) {
+			if (nx < 0 || width <= nx || ny < 0 || height <= ny) {
+				continue;
+			}
+			auto const index = static_cast<std::size_t>(ny * width + nx);
+			if (!region[index] && image.at(nx, ny) == old) {
+				region[index] = true;
+				queue.emplace_back(nx, ny);
+			}
+		}
+	}
+	return region;
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_flood_fill(
+	Image& image, flood_scene scene, point_t seed, color_t color, std::uint32_t scratch_size = 64
+) noexcept {
+	draw_flood_scene(image, scene);
+
+	auto [x, y]                       = seed;
+	std::vector<color_t> const before = copy_pixels(image);
+	std::vector<bool> const    region = make_flood_region(image, x, y);
+
+	std::vector<inknit_flood_span> scratch(scratch_size);
+	CHECK(image.flood_fill(seed, color, scratch));
+
+	std::int32_t const width = image.width();
+	image.test([&](std::int32_t px, std::int32_t py) noexcept {
+		auto const index = static_cast<std::size_t>(py * width + px);
+		return region[index] ? color : before[index];
+	});
+}
+
+// Too little scratch leaves part of the region as it was but never writes outside it
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_flood_fill_partial(
+	Image& image, flood_scene scene, point_t seed, std::uint32_t scratch_size
+) noexcept {
+	draw_flood_scene(image, scene);
+
+	auto [x, y]                       = seed;
+	std::vector<color_t> const before = copy_pixels(image);
+	std::vector<bool> const    region = make_flood_region(image, x, y);
+
+	std::vector<inknit_flood_span> scratch(scratch_size);
+	CHECK(!image.flood_fill(seed, colors::white, scratch));
+
+	std::int32_t const width = image.width();
+	image.test([&](std::int32_t px, std::int32_t py) noexcept {
+		auto const index = static_cast<std::size_t>(py * width + px);
+		bool const fill  = region[index] && image.at(px, py) == colors::white;
+		return fill ? colors::white : before[index];
+	});
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"flood_fill",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...) \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_flood_fill(image, __VA_ARGS__), _MSG)
+#define SUBCASE_INVOKE_PARTIAL(_MSG, ...) \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_flood_fill_partial(image, __VA_ARGS__), _MSG)
+
+	using enum shared::flood_scene;
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	// Noise branches on almost every row
+	auto const noise_size = static_cast<std::uint32_t>(width * height / 16);
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: whole image", empty, {5, 7}, colors::white);
+	SUBCASE_INVOKE("basic: inside a box", box, {width / 2, height / 2}, colors::white);
+	SUBCASE_INVOKE("basic: outside a box", box, {0, 0}, colors::white);
+	SUBCASE_INVOKE("basic: the box itself", box, {3, 2}, colors::black);
+
+	// 2. shapes
+	SUBCASE_INVOKE("shapes: circle overlap", circles, {width / 2 - 2, height / 2}, colors::white);
+	SUBCASE_INVOKE("shapes: around the circles", circles, {width - 1, 0}, colors::white);
+	SUBCASE_INVOKE("shapes: comb", comb, {0, 0}, colors::white);
+	SUBCASE_INVOKE("shapes: comb from the far end", comb, {width - 1, height - 1}, colors::white);
+	SUBCASE_INVOKE("shapes: noise", noise, {width / 2, height / 2}, colors::white, noise_size);
+
+	// 3. degenerate
+	SUBCASE_INVOKE("degenerate: same color", box, {width / 2, height / 2}, colors::black);
+	SUBCASE_INVOKE("degenerate: box without scratch", box, {width / 2, 5}, colors::white, 0);
+
+	// 4. clip
+	SUBCASE_INVOKE("clip: seed left of the image", empty, {-1, 4}, colors::white);
+	SUBCASE_INVOKE("clip: seed below the image", empty, {4, height}, colors::white);
+
+	// 5. scratch
+	SUBCASE_INVOKE_PARTIAL("scratch: none for a comb", comb, {width - 1, height - 1}, 0);
+	SUBCASE_INVOKE_PARTIAL("scratch: none around the circles", circles, {width - 1, 0}, 0);
+	SUBCASE_INVOKE_PARTIAL("scratch: little for noise", noise, {width / 2, height / 2}, 2);
+
+#undef SUBCASE_INVOKE
+#undef SUBCASE_INVOKE_PARTIAL
+}
@@ -0,0 +1,230 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <array>  // array
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+using pattern_t = std::array<std::uint8_t, 8>;
+
+// clang-format off
+constexpr std::uint8_t bayer4[4][4] = {
+	{ 0,  8,  2, 10},
+	{12,  4, 14,  6},
+	{ 3, 11,  1,  9},
+	{15,  7, 13,  5},
+};
+
+constexpr std::uint8_t bayer8[8][8] = {
+	{ 0, 32,  8, 40,  2, 34, 10, 42},
+	{48, 16, 56, 24, 50, 18, 58, 26},
+	{12, 44,  4, 36, 14, 46,  6, 38},
+	{60, 28, 52, 20, 62, 30, 54, 22},
+	{ 3, 35, 11, 43,  1, 33,  9, 41},
+	{51, 19, 59, 27, 49, 17, 57, 25},
+	{15, 47,  7, 39, 13, 45,  5, 37},
+	{63, 31, 55, 23, 61, 29, 53, 21},
+};
+// clang-format on
+
+// The pixels of the shape take white where the pattern bit is set and black elsewhere; the rest
+// keep `outside`
+template<class Function>
+static auto bind_pattern(Function shape, pattern_t const& pattern, color_t outside) noexcept {
+	return [=](std::int32_t x, std::int32_t y) noexcept {
+		if (shape(x, y) == colors::black) {
+			return outside;
+		}
+		std::uint32_t const bits = pattern[static_cast<std::uint32_t>(y) & 7];
+		std::uint32_t const bit  = 0x80u >> (static_cast<std::uint32_t>(x) & 7);
+		return (bits & bit) != 0 ? colors::white : colors::black;
+	};
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_rect_pattern(
+	Image& image, color_t outside, pattern_t const& pattern, point_t pt, size_t sz
+) noexcept {
+	image.clear(outside);
+	image.fill_rect_pattern(pt, sz, pattern, colors::white, colors::black);
+	image.test(bind_pattern(bind_is_pixel_on_rect(pt, sz), pattern, outside));
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_circle_pattern(
+	Image&           image,
+	color_t          outside,
+	pattern_t const& pattern,
+	std::int32_t     cx,
+	std::int32_t     cy,
+	std::int32_t     radius
+) noexcept {
+	image.clear(outside);
+	image.fill_circle_pattern({cx, cy}, radius, pattern, colors::white, colors::black);
+
+	pixel_list const& list = make_midpoint_filled_circle(cx, cy, radius, image.rect());
+	image.test(bind_pattern(bind_is_pixel_on_list(list), pattern, outside));
+}
+
+// Fills the whole image with the dither pattern and compares it with the Bayer matrix
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_dither_pattern(Image& image, std::int32_t level, bool quarter = false) noexcept {
+	pattern_t pattern;
+	inknit_make_dither_pattern(pattern.data(), level);
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	image.clear(colors::black);
+	image.fill_rect_pattern({0, 0}, {width, height}, pattern, colors::white, colors::black);
+	image.test([level, quarter](std::int32_t x, std::int32_t y) noexcept {
+		bool const set = quarter ? 4 * bayer4[y & 3][x & 3] < level : bayer8[y & 7][x & 7] < level;
+		return set ? colors::white : colors::black;
+	});
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"fill_rect_pattern",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+	// Black around the rect shows the set bits, white shows the clear ones
+#define SUBCASE_INVOKE(_MSG, ...)                                                          \
+	SUBCASE(_MSG " (on black)") {                                                          \
+		shared::subtest_fill_rect_pattern(image, colors::black, __VA_ARGS__);              \
+	}                                                                                      \
+	SUBCASE(_MSG " (on white)") {                                                          \
+		shared::subtest_fill_rect_pattern(image, colors::white, __VA_ARGS__);              \
+	}
+
+#define SUBCASE_INVOKE_DITHER(_MSG, ...)                                              \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_dither_pattern(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_EXPECT_ASSERT(_MSG, _EXPECTED_MESSAGE, ...)                             \
+	INKNIT_SUBCASE_EXPECT_ASSERT(                                                       \
+		inknit_make_dither_pattern(shared::pattern_t {}.data(), __VA_ARGS__),           \
+		_MSG,                                                                           \
+		_EXPECTED_MESSAGE                                                               \
+	)
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	shared::pattern_t const checker  = {0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55};
+	shared::pattern_t const diagonal = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+	shared::pattern_t const grid     = {0xFF, 0x81, 0x81, 0x99, 0x99, 0x81, 0x81, 0xFF};
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: checker", checker, {3, 2}, {20, 9});
+	SUBCASE_INVOKE("basic: diagonal", diagonal, {5, 1}, {2 * image.ppw, 13});
+	SUBCASE_INVOKE("basic: grid, odd origin", grid, {7, 5}, {width - 9, height - 8});
+	SUBCASE_INVOKE("basic: inside one word", diagonal, {1, 3}, {5, 10});
+	SUBCASE_INVOKE("basic: word aligned", grid, {0, 0}, {2 * image.ppw, 16});
+
+	// 2. degenerate
+	SUBCASE_INVOKE("degenerate: zero width", checker, {4, 4}, {0, 6});
+	SUBCASE_INVOKE("degenerate: single pixel", diagonal, {9, 9}, {1, 1});
+	SUBCASE_INVOKE("degenerate: single row", grid, {2, 11}, {width - 4, 1});
+
+	// 3. clip
+	SUBCASE_INVOKE("clip: left top", diagonal, {-5, -3}, {16, 12});
+	SUBCASE_INVOKE("clip: covers the image", grid, {-9, -6}, {width + 20, height + 20});
+	SUBCASE_INVOKE("clip: outside", checker, {width + 2, 4}, {10, 10});
+
+	// 4. dither
+	SUBCASE_INVOKE_DITHER("dither: level 0", 0);
+	SUBCASE_INVOKE_DITHER("dither: level 1", 1);
+	SUBCASE_INVOKE_DITHER("dither: level 21", 21);
+	SUBCASE_INVOKE_DITHER("dither: level 32", 32);
+	SUBCASE_INVOKE_DITHER("dither: level 63", 63);
+	SUBCASE_INVOKE_DITHER("dither: level 64", 64);
+	SUBCASE_INVOKE_DITHER("dither: 4x4 level 3", 12, true);
+	SUBCASE_INVOKE_DITHER("dither: 4x4 level 9", 36, true);
+
+	// 5. robust
+	SUBCASE_EXPECT_ASSERT("robust: negative level", "ERROR: level < 0", -1);
+	SUBCASE_EXPECT_ASSERT("robust: level above 64", "ERROR: level > 2^6", 65);
+
+#undef SUBCASE_INVOKE
+#undef SUBCASE_INVOKE_DITHER
+#undef SUBCASE_EXPECT_ASSERT
+}
+
+TEST_CASE_TEMPLATE(
+	"fill_circle_pattern",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...)                                                          \
+	SUBCASE(_MSG " (on black)") {                                                          \
+		shared::subtest_fill_circle_pattern(image, colors::black, __VA_ARGS__);            \
+	}                                                                                      \
+	SUBCASE(_MSG " (on white)") {                                                          \
+		shared::subtest_fill_circle_pattern(image, colors::white, __VA_ARGS__);            \
+	}
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+	std::int32_t const minlen = std::min(width, height);
+
+	shared::pattern_t half;
+	inknit_make_dither_pattern(half.data(), 32);
+	shared::pattern_t const diagonal = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: dithered circle", half, 15, 15, 10);
+	SUBCASE_INVOKE("basic: diagonal", diagonal, 11, 9, 7);
+
+	// 2. degenerate
+	SUBCASE_INVOKE("degenerate: zero radius", diagonal, 8, 8, 0);
+	SUBCASE_INVOKE("degenerate: radius 1", half, 20, 5, 1);
+
+	// 3. clip
+	SUBCASE_INVOKE("clip: partially off-screen", diagonal, width / 4, height / 4, minlen / 2);
+	SUBCASE_INVOKE("clip: all sides", half, width / 2, height / 2, 2 * minlen / 3);
+	SUBCASE_INVOKE("clip: center above the image", diagonal, width / 3, -minlen / 4, minlen);
+
+#undef SUBCASE_INVOKE
+}
@@ -0,0 +1,100 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_polygon(
+	Image& image, fill_rule rule, std::vector<inknit_point> const& points
+) noexcept {
+	std::vector<inknit_polygon_edge> edges(points.size());
+
+	image.clear(colors::black);
+	image.fill_polygon(points, colors::white, rule, edges);
+	image.test(bind_is_pixel_on_polygon(points, rule));
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"fill_polygon",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...)                                                            \
+	SUBCASE(_MSG " (even-odd)") {                                                            \
+		shared::subtest_fill_polygon(image, fill_rule::even_odd, {__VA_ARGS__});             \
+	}                                                                                        \
+	SUBCASE(_MSG " (non-zero)") {                                                            \
+		shared::subtest_fill_polygon(image, fill_rule::nonzero, {__VA_ARGS__});              \
+	}
+
+	auto const right        = static_cast<std::int16_t>(image.width());
+	auto const inner_bottom = static_cast<std::int16_t>(image.height() - 1);
+	auto const outer_right  = static_cast<std::int16_t>(image.width() + 8);
+	auto const outer_bottom = static_cast<std::int16_t>(image.height() + 8);
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: rectangle", {2, 3}, {12, 3}, {12, 9}, {2, 9});
+	SUBCASE_INVOKE("basic: diamond", {8, 0}, {15, 7}, {8, 15}, {1, 8});
+	SUBCASE_INVOKE("basic: quad with a straight corner", {2, 2}, {8, 2}, {14, 2}, {8, 12});
+	SUBCASE_INVOKE("basic: concave quad", {1, 1}, {14, 4}, {6, 6}, {3, 14});
+	SUBCASE_INVOKE("basic: triangle", {3, 1}, {14, 6}, {1, 12});
+	SUBCASE_INVOKE("basic: counter-clockwise triangle", {3, 1}, {1, 12}, {14, 6});
+	SUBCASE_INVOKE("basic: concave arrow", {1, 6}, {8, 1}, {15, 6}, {10, 6}, {10, 14}, {6, 14});
+	SUBCASE_INVOKE("basic: shallow and steep edges", {0, 2}, {right, 5}, {6, inner_bottom});
+
+	// 2. rules
+	// A star crosses itself, so its center is inside for non-zero but outside for even-odd.
+	SUBCASE_INVOKE("rules: pentagram", {8, 0}, {13, 15}, {0, 5}, {16, 5}, {3, 15});
+	SUBCASE_INVOKE("rules: bow tie", {1, 1}, {14, 12}, {14, 1}, {1, 12});
+	SUBCASE_INVOKE(
+		"rules: doubly wound square", {2, 2}, {12, 2}, {12, 12}, {2, 12}, {2, 2}, {12, 2}, {12, 12},
+		{2, 12}
+	);
+
+	// 3. degenerate
+	SUBCASE_INVOKE("degenerate: no points", );
+	SUBCASE_INVOKE("degenerate: single point", {3, 3});
+	SUBCASE_INVOKE("degenerate: line", {2, 2}, {10, 9});
+	SUBCASE_INVOKE("degenerate: flat triangle", {2, 4}, {8, 4}, {12, 4});
+	SUBCASE_INVOKE("degenerate: thin sliver", {2, 2}, {3, 2}, {14, 13});
+
+	// 4. clip
+	SUBCASE_INVOKE("clip: all sides", {-6, 4}, {8, -9}, {outer_right, 6}, {9, outer_bottom});
+	SUBCASE_INVOKE("clip: covers the image", {-20, -20}, {outer_right, -20}, {0, outer_bottom});
+	SUBCASE_INVOKE("clip: outside", {-9, 2}, {-2, 5}, {-5, 12});
+	SUBCASE_INVOKE("clip: max coordinate range", {-2048, -2048}, {2047, 20}, {-2048, 2047});
+
+#undef SUBCASE_INVOKE
+}
@@ -73,6 +73,15 @@ TEST_CASE_TEMPLATE(
 	// 5. full
 	SUBCASE_INVOKE(0, 0, image.width(), image.height(), "full: full-image rectangle");
 
+	// 6. word layout
+	// Narrow rects are filled column by column, wider ones row by row.
+	std::int32_t const ppw = image.ppw;
+	SUBCASE_INVOKE(3, 1, ppw / 2, 20, "word: tall rect within one word");
+	SUBCASE_INVOKE(ppw - 3, 1, 6, 20, "word: tall rect across two words");
+	SUBCASE_INVOKE(ppw - 3, 1, ppw + 6, 20, "word: rect across three words");
+	SUBCASE_INVOKE(1, 2, 3 * ppw + 5, 9, "word: wide unaligned rect");
+	SUBCASE_INVOKE(ppw, 2, 2 * ppw, 9, "word: word-aligned rect");
+
 #undef SUBCASE_INVOKE
 
 	SUBCASE("single-column") {
@@ -0,0 +1,130 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_round_rect(
+	Image&       image,
+	point_t      pt,
+	size_t       sz,
+	std::int32_t radius,
+	bool         cached    = false,
+	bool         skip_test = false
+) noexcept {
+	std::vector<std::uint8_t> insets;
+	if (cached) {
+		insets.resize(static_cast<std::size_t>(radius));
+		inknit_make_round_corner(insets.data(), radius);
+	}
+
+	image.clear(colors::black);
+	image.fill_round_rect(pt, sz, radius, colors::white, insets);
+
+	if (!skip_test) {
+		image.test(bind_is_pixel_on_round_rect(pt, sz, radius));
+	}
+}
+
+// A square of side 2r + 1 is the filled circle of radius r
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_round_rect_as_circle(
+	Image& image, std::int32_t cx, std::int32_t cy, std::int32_t radius
+) noexcept {
+	std::int32_t const side = 2 * radius + 1;
+
+	image.clear(colors::black);
+	image.fill_round_rect({cx - radius, cy - radius}, {side, side}, radius, colors::white);
+
+	pixel_list const& list = make_midpoint_filled_circle(cx, cy, radius, image.rect());
+	image.test(bind_is_pixel_on_list(list));
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"fill_round_rect",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...)                                                    \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_fill_round_rect(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_INVOKE_CIRCLE(_MSG, ...)                                                       \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_fill_round_rect_as_circle(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_EXPECT_ASSERT(_MSG, _EXPECTED_MESSAGE, ...)               \
+	INKNIT_SUBCASE_EXPECT_ASSERT(                                         \
+		shared::subtest_fill_round_rect(image, __VA_ARGS__, false, true), \
+		_MSG,                                                             \
+		_EXPECTED_MESSAGE                                                 \
+	)
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: button", {2, 3}, {24, 12}, 4);
+	SUBCASE_INVOKE("basic: tall", {5, 1}, {9, 28}, 3);
+	SUBCASE_INVOKE("basic: radius 1", {3, 3}, {10, 8}, 1);
+	SUBCASE_INVOKE("basic: cached table", {2, 3}, {24, 12}, 4, true);
+	SUBCASE_INVOKE("basic: cached table, radius 7", {1, 2}, {27, 20}, 7, true);
+
+	// 2. circle
+	SUBCASE_INVOKE_CIRCLE("circle: radius 1", 8, 8, 1);
+	SUBCASE_INVOKE_CIRCLE("circle: radius 5", 10, 12, 5);
+	SUBCASE_INVOKE_CIRCLE("circle: radius 12", 15, 15, 12);
+
+	// 3. degenerate
+	SUBCASE_INVOKE("degenerate: zero radius", {4, 4}, {10, 6}, 0);
+	SUBCASE_INVOKE("degenerate: zero width", {4, 4}, {0, 6}, 2);
+	SUBCASE_INVOKE("degenerate: single pixel", {4, 4}, {1, 1}, 3);
+	SUBCASE_INVOKE("degenerate: clamped to the short side", {2, 2}, {20, 7}, 9);
+	SUBCASE_INVOKE("degenerate: clamped, even side", {2, 2}, {8, 20}, 9);
+
+	// 4. clip
+	SUBCASE_INVOKE("clip: left top", {-5, -3}, {16, 12}, 6);
+	SUBCASE_INVOKE("clip: right bottom", {width - 10, height - 7}, {16, 12}, 6);
+	SUBCASE_INVOKE("clip: covers the image", {-4, -4}, {width + 8, height + 8}, 10);
+	SUBCASE_INVOKE("clip: outside", {width + 2, 4}, {10, 10}, 3);
+	SUBCASE_INVOKE("clip: corners only", {-2, -2}, {width + 4, height + 4}, 15, true);
+
+	// 5. robust
+	SUBCASE_EXPECT_ASSERT("robust: negative radius", "ERROR: radius < 0", {4, 4}, {10, 8}, -1);
+
+#undef SUBCASE_INVOKE
+#undef SUBCASE_INVOKE_CIRCLE
+#undef SUBCASE_EXPECT_ASSERT
+}
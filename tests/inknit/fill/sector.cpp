@@ -0,0 +1,120 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_sector(
+	Image&       image,
+	point_t      ct,
+	std::int32_t radius,
+	std::int32_t start,
+	std::int32_t end,
+	bool         skip_test = false
+) noexcept {
+	image.clear(colors::black);
+	image.fill_sector(ct, radius, start, end, colors::white);
+
+	if (!skip_test) {
+		image.test(bind_is_pixel_on_sector(ct, radius, start, end));
+	}
+}
+
+// A whole turn from any start is the filled circle
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_sector_as_circle(
+	Image& image, std::int32_t cx, std::int32_t cy, std::int32_t radius, std::int32_t start
+) noexcept {
+	image.clear(colors::black);
+	image.fill_sector({cx, cy}, radius, start, start + 360, colors::white);
+
+	pixel_list const& list = make_midpoint_filled_circle(cx, cy, radius, image.rect());
+	image.test(bind_is_pixel_on_list(list));
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"fill_sector",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...)                                                \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_fill_sector(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_INVOKE_CIRCLE(_MSG, ...)                                                   \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_fill_sector_as_circle(image, __VA_ARGS__), _MSG)
+
+#define SUBCASE_EXPECT_ASSERT(_MSG, _EXPECTED_MESSAGE, ...)                            \
+	INKNIT_SUBCASE_EXPECT_ASSERT(                                                      \
+		shared::subtest_fill_sector(image, __VA_ARGS__, true), _MSG, _EXPECTED_MESSAGE \
+	)
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: first quarter", {15, 15}, 12, 0, 90);
+	SUBCASE_INVOKE("basic: upper half", {15, 15}, 12, 180, 360);
+	SUBCASE_INVOKE("basic: pac-man", {15, 15}, 12, 30, 330);
+	SUBCASE_INVOKE("basic: 10% from the top", {15, 15}, 12, -90, -54);
+	SUBCASE_INVOKE("basic: 50% from the top", {15, 15}, 12, -90, 90);
+	SUBCASE_INVOKE("basic: 90% from the top", {15, 15}, 12, -90, 234);
+	SUBCASE_INVOKE("basic: narrow", {15, 15}, 14, 10, 15);
+	SUBCASE_INVOKE("basic: odd angles", {16, 14}, 11, 17, 133);
+	SUBCASE_INVOKE("basic: wraps past 360", {15, 15}, 12, 300, 30);
+
+	// 2. circle
+	SUBCASE_INVOKE_CIRCLE("circle: radius 1", 8, 8, 1, 0);
+	SUBCASE_INVOKE_CIRCLE("circle: radius 5", 10, 12, 5, 45);
+	SUBCASE_INVOKE_CIRCLE("circle: radius 12", 15, 15, 12, -37);
+
+	// 3. degenerate
+	SUBCASE_INVOKE("degenerate: empty sweep", {15, 15}, 12, 30, 30);
+	SUBCASE_INVOKE("degenerate: zero radius", {15, 15}, 0, 0, 90);
+	SUBCASE_INVOKE("degenerate: half turn", {15, 15}, 12, 45, 225);
+
+	// 4. clip
+	SUBCASE_INVOKE("clip: left top", {3, 4}, 12, 90, 300);
+	SUBCASE_INVOKE("clip: right bottom", {width - 4, height - 3}, 12, 160, 290);
+	SUBCASE_INVOKE("clip: center outside", {-6, height / 2}, 14, -60, 60);
+	SUBCASE_INVOKE("clip: larger than the image", {width / 2, height / 2}, width, 20, 250);
+
+	// 5. robust
+	SUBCASE_EXPECT_ASSERT("robust: negative radius", "ERROR: radius < 0", {15, 15}, -1, 0, 90);
+
+#undef SUBCASE_INVOKE
+#undef SUBCASE_INVOKE_CIRCLE
+#undef SUBCASE_EXPECT_ASSERT
+}
@@ -0,0 +1,84 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_fill_triangle(Image& image, point_t pt1, point_t pt2, point_t pt3) noexcept {
+	auto const to_point = [](point_t pt) noexcept {
+		auto [x, y] = pt;
+		return inknit_point {static_cast<std::int16_t>(x), static_cast<std::int16_t>(y)};
+	};
+
+	image.clear(colors::black);
+	image.fill_triangle(pt1, pt2, pt3, colors::white);
+
+	std::vector<inknit_point> const points {to_point(pt1), to_point(pt2), to_point(pt3)};
+	image.test(bind_is_pixel_on_polygon(points, fill_rule::even_odd));
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"fill_triangle",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 4 * image.ppw);
+
+#define SUBCASE_INVOKE(_MSG, ...)                                                  \
+	INKNIT_SUBCASE_INVOKE(shared::subtest_fill_triangle(image, __VA_ARGS__), _MSG)
+
+	std::int32_t const width  = image.width();
+	std::int32_t const height = image.height();
+
+	// 1. basic
+	SUBCASE_INVOKE("basic: clockwise triangle", {3, 1}, {14, 6}, {1, 12});
+	SUBCASE_INVOKE("basic: counter-clockwise triangle", {3, 1}, {1, 12}, {14, 6});
+	SUBCASE_INVOKE("basic: flat top", {2, 3}, {13, 3}, {7, 12});
+	SUBCASE_INVOKE("basic: flat bottom", {7, 2}, {13, 12}, {2, 12});
+	SUBCASE_INVOKE("basic: shallow and steep edges", {0, 2}, {width, 5}, {6, height - 1});
+
+	// 2. degenerate
+	SUBCASE_INVOKE("degenerate: single point", {3, 3}, {3, 3}, {3, 3});
+	SUBCASE_INVOKE("degenerate: flat", {2, 4}, {8, 4}, {12, 4});
+	SUBCASE_INVOKE("degenerate: collinear", {2, 2}, {12, 12}, {7, 7});
+	SUBCASE_INVOKE("degenerate: thin sliver", {2, 2}, {3, 2}, {14, 13});
+
+	// 3. clip
+	SUBCASE_INVOKE("clip: all sides", {-6, 4}, {width + 8, -9}, {9, height + 8});
+	SUBCASE_INVOKE("clip: covers the image", {-20, -20}, {width + 20, -20}, {0, height + 20});
+	SUBCASE_INVOKE("clip: enters below the top", {5, -30}, {12, -4}, {-3, 9});
+	SUBCASE_INVOKE("clip: outside", {-9, 2}, {-2, 5}, {-5, 12});
+	SUBCASE_INVOKE("clip: max coordinate range", {-2048, -2048}, {2047, 20}, {-2048, 2047});
+
+#undef SUBCASE_INVOKE
+}
@@ -0,0 +1,130 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_blit_scaled(
+	Image&       dst,
+	std::int32_t dx,
+	std::int32_t dy,
+	std::int32_t dw,
+	std::int32_t dh,
+	Image&       src,
+	std::int32_t sx,
+	std::int32_t sy,
+	std::int32_t sw,
+	std::int32_t sh
+) noexcept {
+	// Neighbouring source pixels and rows differ, so a wrong column or row changes the result.
+	color_t const max       = (1u << Image::bpp) - 1;
+	auto const    src_color = [=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		return static_cast<color_t>(x + 3 * y + (x * y >> 2)) & max;
+	};
+	auto const dst_color = [=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		return static_cast<color_t>(3 * x + y + 1) & max;
+	};
+	for (std::int32_t y = 0; y < src.height(); ++y) {
+		for (std::int32_t x = 0; x < src.width(); ++x) {
+			src.draw_point(x, y, src_color(x, y));
+		}
+	}
+	for (std::int32_t y = 0; y < dst.height(); ++y) {
+		for (std::int32_t x = 0; x < dst.width(); ++x) {
+			dst.draw_point(x, y, dst_color(x, y));
+		}
+	}
+
+	dst.blit_scaled({dx, dy}, {dw, dh}, src, {sx, sy}, {sw, sh});
+	dst.test([=](std::int32_t x, std::int32_t y) noexcept -> color_t {
+		if (x < dx || x >= dx + dw || y < dy || y >= dy + dh || sw == 0 || sh == 0) {
+			return dst_color(x, y);
+		}
+
+		// The source pixel under the center of the destination pixel
+		std::int32_t const col = sx + ((2 * (x - dx) + 1) * sw) / (2 * dw);
+		std::int32_t const row = sy + ((2 * (y - dy) + 1) * sh) / (2 * dh);
+		return src_color(col, row);
+	});
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"blit_scaled",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	// The destination is wider than one map strip, and large enough for the LUT path.
+	Image src, dst;
+	src.reset(160, 48);
+	dst.reset(300, 96);
+
+#define SUBCASE_INVOKE(_MSG, _DX, _DY, _DW, _DH, _SX, _SY, _SW, _SH)                    \
+	SUBCASE(_MSG) {                                                                      \
+		shared::subtest_blit_scaled(dst, _DX, _DY, _DW, _DH, src, _SX, _SY, _SW, _SH); \
+	}
+
+	// clang-format off
+
+	// 1. exact factors
+	// Large rects take the LUT, small ones the map.
+	SUBCASE_INVOKE("factor: 1x, unaligned",          3,  1,  37, 20,  5,  2, 37, 20);
+	SUBCASE_INVOKE("factor: 2x, large",              0,  0, 300, 96,  4,  0, 150, 48);
+	SUBCASE_INVOKE("factor: 2x, large, unaligned",   5,  3, 246, 90,  7,  1, 123, 45);
+	SUBCASE_INVOKE("factor: 3x, large, unaligned",   1,  2, 297, 93,  3,  5, 99, 31);
+	SUBCASE_INVOKE("factor: 4x, large, unaligned",   7,  0, 292, 96, 13,  9, 73, 24);
+	SUBCASE_INVOKE("factor: 2x, small",              3,  5,  14,  6,  5,  2,  7,  3);
+	SUBCASE_INVOKE("factor: 4x, small",              1,  1,  20,  8,  9,  4,  5,  2);
+	SUBCASE_INVOKE("factor: 2x wide, 3x tall",       2,  2, 200, 90,  1,  3, 100, 30);
+
+	// 2. ratios
+	SUBCASE_INVOKE("ratio: 5:3 upscale",             2,  1, 250, 80,  3,  2, 150, 46);
+	SUBCASE_INVOKE("ratio: 1:2 downscale",           4,  4,  80, 24,  0,  0, 160, 48);
+	SUBCASE_INVOKE("ratio: 3:7 downscale",           9,  3,  60, 18,  1,  2, 140, 42);
+	SUBCASE_INVOKE("ratio: stretch wide, shrink tall", 0, 0, 300, 10, 10, 0, 40, 48);
+	SUBCASE_INVOKE("ratio: single source pixel",    11,  7,  33, 21, 17,  9,  1,  1);
+	SUBCASE_INVOKE("ratio: single destination pixel", 11, 7,  1,  1,  0,  0, 160, 48);
+
+	// 3. clip
+	// A clipped left edge starts inside the copies of a source pixel.
+	SUBCASE_INVOKE("clip: left and top, 3x",        -7, -5, 300, 96,  0,  0, 100, 32);
+	SUBCASE_INVOKE("clip: right and bottom, 2x",   201, 50, 200, 90,  2,  2, 100, 45);
+	SUBCASE_INVOKE("clip: every side, 11:5",       -11, -9, 330, 120, 1,  1, 150, 47);
+	SUBCASE_INVOKE("clip: outside",                300, 10,  20, 20,  0,  0, 10, 10);
+
+	// 4. degenerate
+	SUBCASE_INVOKE("degenerate: zero destination width",  5, 5,  0, 10, 0, 0, 10, 10);
+	SUBCASE_INVOKE("degenerate: zero source height",      5, 5, 10, 10, 0, 0, 10,  0);
+
+	// clang-format on
+
+#undef SUBCASE_INVOKE
+}
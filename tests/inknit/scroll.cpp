@@ -0,0 +1,142 @@
+/*
+ * inknit <https://github.com/mntone/inknit>
+ *
+ * Copyright (C) 2025 mntone <901816+mntone@users.noreply.github.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "inknit_test.hpp"
+
+namespace inknit::tests::shared {
+
+static constexpr color_t scroll_pattern(std::int32_t x, std::int32_t y) noexcept {
+	// Diagonal stripes, so any horizontal or vertical shift of the copied bits changes the result.
+	return (x + 2 * y) % 3 == 0 ? colors::white : colors::black;
+}
+
+template<typename Image>
+	requires std::convertible_to<Image, inknit::details::image_primitive>
+void subtest_scroll(
+	Image&       image,
+	std::int32_t x,
+	std::int32_t y,
+	std::int32_t width,
+	std::int32_t height,
+	std::int32_t dx,
+	std::int32_t dy
+) noexcept {
+	image.clear(colors::black);
+	for (std::int32_t py = 0; py < image.height(); ++py) {
+		for (std::int32_t px = 0; px < image.width(); ++px) {
+			if (scroll_pattern(px, py) == colors::white) {
+				image.draw_point(px, py, colors::white);
+			}
+		}
+	}
+
+	image.scroll({x, y}, {width, height}, dx, dy, colors::white);
+
+	// The rectangle is clipped to the image before scrolling.
+	std::int32_t const right  = std::min(x + width, image.width());
+	std::int32_t const bottom = std::min(y + height, image.height());
+	image.test([=](std::int32_t px, std::int32_t py) noexcept -> color_t {
+		auto const inside = [=](std::int32_t qx, std::int32_t qy) noexcept {
+			return x <= qx && qx < right && y <= qy && qy < bottom;
+		};
+		if (!inside(px, py)) {
+			return scroll_pattern(px, py);
+		}
+		if (!inside(px - dx, py - dy)) {
+			return colors::white;
+		}
+		return scroll_pattern(px - dx, py - dy);
+	});
+}
+
+}  // namespace inknit::tests::shared
+
+using namespace inknit;
+using namespace inknit::tests;
+
+TEST_CASE_TEMPLATE(
+	"scroll",
+	Image,
+	test_image<pixel_layout::x1, pixel_format::grayscale>,
+	test_image<pixel_layout::x1lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x2, pixel_format::grayscale>,
+	test_image<pixel_layout::x2lsb, pixel_format::grayscale>,
+	test_image<pixel_layout::x4, pixel_format::grayscale>,
+	test_image<pixel_layout::x4lsb, pixel_format::grayscale>
+) {
+	Image image;
+	image.reset(4 * image.ppw, 24);
+
+#define SUBCASE_INVOKE(_IX, _IY, _IW, _IH, _IDX, _IDY, _MSG)                     \
+	do {                                                                         \
+		SUBCASE(_MSG) {                                                          \
+			shared::subtest_scroll(image, _IX, _IY, _IW, _IH, _IDX, _IDY);       \
+		}                                                                        \
+	} while (false)
+
+	// SUBCASE_INVOKE(IX, IY, IW, IH, IDX, IDY, MSG)
+	// IX, IY:   Scroll rectangle top-left coordinate (X, Y)
+	// IW, IH:   Scroll rectangle dimensions (Width, Height)
+	// IDX, IDY: Scroll offset (X, Y)
+	// MSG:      Description of the test case
+
+	std::int32_t const ppw = image.ppw;
+	std::int32_t const w   = image.width();
+	std::int32_t const h   = image.height();
+
+	// clang-format off
+
+	// 1. vertical
+	// Whole rows move; rows must be walked against the scroll direction.
+	SUBCASE_INVOKE(0, 0, w, h, 0, -3, "vertical: full image up");
+	SUBCASE_INVOKE(0, 0, w, h, 0, 3, "vertical: full image down");
+	SUBCASE_INVOKE(3, 2, w - ppw, 10, 0, 1, "vertical: unaligned rect down");
+
+	// 2. horizontal
+	// Rows overlap with themselves; words must be walked against the scroll direction.
+	SUBCASE_INVOKE(0, 0, w, h, -ppw, 0, "horizontal: full image left by a word");
+	SUBCASE_INVOKE(0, 0, w, h, ppw, 0, "horizontal: full image right by a word");
+	SUBCASE_INVOKE(0, 0, w, h, -1, 0, "horizontal: full image left by a pixel");
+	SUBCASE_INVOKE(0, 0, w, h, 1, 0, "horizontal: full image right by a pixel");
+	SUBCASE_INVOKE(3, 1, w - 5, 6, -5, 0, "horizontal: unaligned rect left");
+	SUBCASE_INVOKE(3, 1, w - 5, 6, ppw + 5, 0, "horizontal: unaligned rect right");
+	SUBCASE_INVOKE(2, 1, ppw / 2, 6, 1, 0, "horizontal: within one word");
+
+	// 3. diagonal
+	SUBCASE_INVOKE(1, 1, w - 2, h - 2, 3, 2, "diagonal: right-down");
+	SUBCASE_INVOKE(1, 1, w - 2, h - 2, -3, -2, "diagonal: left-up");
+	SUBCASE_INVOKE(1, 1, w - 2, h - 2, 3, -2, "diagonal: right-up");
+	SUBCASE_INVOKE(1, 1, w - 2, h - 2, -3, 2, "diagonal: left-down");
+
+	// 4. degenerate
+	// Offsets at least as large as the rectangle only fill; zero offsets leave the image as is.
+	SUBCASE_INVOKE(3, 2, 10, 10, 0, 0, "degenerate: zero offset");
+	SUBCASE_INVOKE(3, 2, 10, 10, 10, 0, "degenerate: offset equals width");
+	SUBCASE_INVOKE(3, 2, 10, 10, 0, -12, "degenerate: offset exceeds height");
+
+	// 5. clipping
+	// Rectangles extending past the image are clipped before scrolling.
+	SUBCASE("clip: rect past bottom-right") {
+		shared::subtest_scroll(image, w / 2, h / 2, w, h, -2, -1);
+	}
+
+	// clang-format on
+
+#undef SUBCASE_INVOKE
+}
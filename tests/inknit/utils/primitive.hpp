@@ -19,7 +19,10 @@
 
 #pragma once
 
+#include <algorithm>   // max, min
+#include <cmath>       // lround, sqrt, tan
 #include <functional>  // bind
+#include <numbers>     // pi
 #include <vector>      // vector
 
 #include "inknit.hpp"
@@ -74,6 +77,171 @@ namespace details {
 		return x < 0 ? -x : x;
 	}
 
+	// round(tan(degrees) * 4096), the slope inknit keeps for an angle within an octant
+	inline std::int32_t arc_slope(std::int32_t degrees) noexcept {
+		double const radians = degrees * std::numbers::pi / 180.0;
+		return static_cast<std::int32_t>(std::lround(std::tan(radians) * 4096.0));
+	}
+
+	// The direction of `angle` in degrees, whose longer component is 4096. It is the slope within
+	// the octant turned clockwise a quarter at a time.
+	inline point_t arc_direction(std::int32_t angle) noexcept {
+		angle                     = (angle % 360 + 360) % 360;
+		std::int32_t const within = angle % 90;
+
+		std::int32_t dx = within <= 45 ? 4096 : arc_slope(90 - within);
+		std::int32_t dy = within <= 45 ? arc_slope(within) : 4096;
+		for (std::int32_t quarter = angle / 90; quarter > 0; --quarter) {
+			std::int32_t const t = dx;
+			dx                   = -dy;
+			dy                   = t;
+		}
+		return {dx, dy};
+	}
+
+	// A stroke as inknit fills it: convex outlines with corners in 1/16 pixel, and the discs of
+	// round joins
+	struct stroke_t {
+		std::vector<std::vector<point_t>> outlines;
+		std::vector<point_t>              discs;
+		std::int32_t                      radius;
+	};
+
+	// round(numer / den) with halves away from zero
+	constexpr std::int32_t round_div(std::int64_t numer, std::int64_t den) noexcept {
+		return static_cast<std::int32_t>(
+			numer >= 0 ? (numer + den / 2) / den : -((-numer + den / 2) / den)
+		);
+	}
+
+	constexpr point_t stroke_center(point_t ipt) noexcept {
+		auto [x, y] = ipt;
+		return {x * 16 + 8, y * 16 + 8};
+	}
+
+	// Half the thickness a quarter turn clockwise from the direction, and half a pixel along it.
+	// A point has no direction and gets a square.
+	inline std::pair<point_t, point_t>
+	stroke_offsets(std::int32_t dx, std::int32_t dy, std::int32_t thickness) noexcept {
+		std::int32_t const half = thickness * 8;
+		if (dx == 0 && dy == 0) {
+			return {{0, half}, {half, 0}};
+		}
+
+		std::int64_t const square = std::int64_t {dx} * dx + std::int64_t {dy} * dy;
+		auto const length = static_cast<std::int64_t>(std::sqrt(static_cast<double>(square << 16)));
+		return {
+			{round_div(std::int64_t {-dy} * half * 256, length),
+			 round_div(std::int64_t {dx} * half * 256, length)},
+			{round_div(std::int64_t {dx} * 8 * 256, length),
+			 round_div(std::int64_t {dy} * 8 * 256, length)},
+		};
+	}
+
+	inline void add_stroke_band(
+		stroke_t& stroke,
+		point_t   ipt1,
+		point_t   ipt2,
+		point_t   across,
+		point_t   along,
+		bool      start_cap,
+		bool      end_cap
+	) noexcept {
+		auto [sx, sy] = stroke_center(ipt1);
+		auto [ex, ey] = stroke_center(ipt2);
+		auto [ax, ay] = across;
+		auto [lx, ly] = along;
+		if (start_cap) {
+			sx -= lx;
+			sy -= ly;
+		}
+		if (end_cap) {
+			ex += lx;
+			ey += ly;
+		}
+		stroke.outlines.push_back({
+			{sx + ax, sy + ay},
+			{ex + ax, ey + ay},
+			{ex - ax, ey - ay},
+			{sx - ax, sy - ay},
+		});
+	}
+
+	// Bands between the points, capped by half a pixel at both ends, and a join at every turn
+	inline stroke_t make_thick_polyline(
+		std::vector<inknit_point> const& ipoints, std::int32_t thickness, line_join join
+	) noexcept {
+		stroke_t stroke {{}, {}, thickness / 2};
+
+		std::vector<point_t> points;
+		for (inknit_point const& ipt : ipoints) {
+			if (points.empty() || points.back() != point_t {ipt.x, ipt.y}) {
+				points.emplace_back(ipt.x, ipt.y);
+			}
+		}
+		if (points.empty()) {
+			return stroke;
+		}
+
+		std::size_t const last = points.size() - 1;
+		if (last == 0) {
+			auto [across, along] = stroke_offsets(0, 0, thickness);
+			add_stroke_band(stroke, points[0], points[0], across, along, true, true);
+			return stroke;
+		}
+
+		for (std::size_t i = 0; i < last; ++i) {
+			auto [x1, y1]        = points[i];
+			auto [x2, y2]        = points[i + 1];
+			auto [across, along] = stroke_offsets(x2 - x1, y2 - y1, thickness);
+			add_stroke_band(stroke, points[i], points[i + 1], across, along, i == 0, i + 1 == last);
+		}
+
+		for (std::size_t i = 1; i < last; ++i) {
+			auto [x0, y0] = points[i - 1];
+			auto [x1, y1] = points[i];
+			auto [x2, y2] = points[i + 1];
+
+			std::int32_t const cross = (x1 - x0) * (y2 - y1) - (y1 - y0) * (x2 - x1);
+			std::int32_t const dot   = (x1 - x0) * (x2 - x1) + (y1 - y0) * (y2 - y1);
+			if (cross == 0 && dot > 0) {
+				continue;
+			}
+			if (join == line_join::round) {
+				stroke.discs.push_back(points[i]);
+				continue;
+			}
+
+			// The notch on the outer side of the turn
+			std::int32_t const sign = cross > 0 ? -1 : 1;
+			auto [a1x, a1y]         = stroke_offsets(x1 - x0, y1 - y0, thickness).first;
+			auto [a2x, a2y]         = stroke_offsets(x2 - x1, y2 - y1, thickness).first;
+			point_t const outer1    = {a1x * sign, a1y * sign};
+			point_t const outer2    = {a2x * sign, a2y * sign};
+			auto [cx, cy]           = stroke_center(points[i]);
+
+			std::vector<point_t> outline = {
+				{cx, cy},
+				{cx + outer1.first, cy + outer1.second},
+				{cx + outer2.first, cy + outer2.second},
+			};
+
+			// The tip is (outer1 + outer2) * h^2 / (h^2 + outer1 . outer2), kept within 4 * h
+			auto [o1x, o1y]            = outer1;
+			auto [o2x, o2y]            = outer2;
+			std::int32_t const square  = (o1x * o1x + o1y * o1y + o2x * o2x + o2y * o2y) >> 1;
+			std::int32_t const product = o1x * o2x + o1y * o2y;
+			if (join == line_join::miter && product * 8 >= square * -7) {
+				std::int64_t const den = square + product;
+				std::int32_t const tx  = round_div(std::int64_t {o1x + o2x} * square, den);
+				std::int32_t const ty  = round_div(std::int64_t {o1y + o2y} * square, den);
+				outline.insert(outline.begin() + 2, {cx + tx, cy + ty});
+			}
+			stroke.outlines.push_back(std::move(outline));
+		}
+		return stroke;
+	}
+
 }  // namespace details
 
 namespace is_pixel_on {
@@ -152,6 +320,207 @@ namespace is_pixel_on {
 		return false;
 	}
 
+	// A pixel is inside when its center is, counting every edge crossed left of or at the center.
+	// Everything is scaled by 2 * dy so the test stays in integers.
+	INKNIT_NODISCARD
+	static constexpr bool polygon(
+		std::int32_t                     x,
+		std::int32_t                     y,
+		std::vector<inknit_point> const& ipoints,
+		fill_rule                        rule
+	) noexcept {
+		std::int32_t crossings = 0;
+		std::int32_t winding   = 0;
+		for (std::size_t i = 0; i < ipoints.size(); ++i) {
+			inknit_point const& p1 = ipoints[i];
+			inknit_point const& p2 = ipoints[(i + 1) % ipoints.size()];
+			if (p1.y == p2.y) {
+				continue;
+			}
+
+			bool const         down = p1.y < p2.y;
+			std::int32_t const x0   = down ? p1.x : p2.x;
+			std::int32_t const y0   = down ? p1.y : p2.y;
+			std::int32_t const dx   = (down ? p2.x : p1.x) - x0;
+			std::int32_t const dy   = (down ? p2.y : p1.y) - y0;
+			if (y < y0 || y0 + dy <= y) {
+				continue;
+			}
+
+			if ((2 * (x - x0) + 1) * dy >= (2 * (y - y0) + 1) * dx) {
+				++crossings;
+				winding += down ? 1 : -1;
+			}
+		}
+		return rule == fill_rule::even_odd ? (crossings & 1) != 0 : winding != 0;
+	}
+
+	// The corners are quadrants of the filled midpoint circle: a pixel (dx, dy) away from the
+	// corner center is inside when dx^2 + dy^2 - max(dx, dy) < r^2.
+	INKNIT_NODISCARD
+	static constexpr bool round_rect(
+		std::int32_t x, std::int32_t y, point_t ipt, size_t isz, std::int32_t radius
+	) noexcept {
+		if (!rect(x, y, ipt, isz)) {
+			return false;
+		}
+
+		auto [left, top]     = ipt;
+		auto [width, height] = isz;
+		radius               = std::min(radius, std::min(width, height) / 2);
+		if (radius <= 0) {
+			return true;
+		}
+
+		std::int32_t const right  = left + width - 1;
+		std::int32_t const bottom = top + height - 1;
+		std::int32_t const dx     = std::max({left + radius - x, x - (right - radius), 0});
+		std::int32_t const dy     = std::max({top + radius - y, y - (bottom - radius), 0});
+		return dx * dx + dy * dy - std::max(dx, dy) < radius * radius;
+	}
+
+	// Keeps the pixels of the filled shape that are within `thickness` of its outside, looking
+	// left, right, up and down
+	INKNIT_NODISCARD
+	static constexpr bool round_rect_edge(
+		std::int32_t x,
+		std::int32_t y,
+		point_t      ipt,
+		size_t       isz,
+		std::int32_t radius,
+		std::int32_t thickness
+	) noexcept {
+		if (!round_rect(x, y, ipt, isz, radius)) {
+			return false;
+		}
+		return !round_rect(x - thickness, y, ipt, isz, radius)
+			|| !round_rect(x + thickness, y, ipt, isz, radius)
+			|| !round_rect(x, y - thickness, ipt, isz, radius)
+			|| !round_rect(x, y + thickness, ipt, isz, radius);
+	}
+
+	// The pixels of the filled midpoint circle: dx^2 + dy^2 - max(dx, dy) < r^2
+	INKNIT_NODISCARD
+	static constexpr bool
+	filled_circle(std::int32_t x, std::int32_t y, point_t ict, std::int32_t radius) noexcept {
+		auto [cx, cy]         = ict;
+		std::int32_t const dx = details::abs(x - cx);
+		std::int32_t const dy = details::abs(y - cy);
+		if (radius <= 0) {
+			return radius == 0 && dx == 0 && dy == 0;
+		}
+		return dx * dx + dy * dy - std::max(dx, dy) < radius * radius;
+	}
+
+	// The angles from `start` clockwise to `end`: between both rays up to a half turn, and not
+	// strictly outside both past that
+	INKNIT_NODISCARD
+	static bool wedge(
+		std::int32_t x, std::int32_t y, point_t ict, std::int32_t start, std::int32_t end
+	) noexcept {
+		std::int32_t sweep = end - start;
+		if (sweep >= 360) {
+			return true;
+		}
+		sweep = (sweep % 360 + 360) % 360;
+		if (sweep == 0) {
+			return false;
+		}
+
+		auto [cx, cy]         = ict;
+		auto [sx, sy]         = details::arc_direction(start);
+		auto [ex, ey]         = details::arc_direction(start + sweep);
+		std::int32_t const dx = x - cx;
+		std::int32_t const dy = y - cy;
+
+		std::int32_t const from_start = sx * dy - sy * dx;
+		std::int32_t const to_end     = dx * ey - dy * ex;
+		if (sweep <= 180) {
+			return from_start >= 0 && to_end >= 0;
+		}
+		return from_start >= 0 || to_end >= 0;
+	}
+
+	INKNIT_NODISCARD
+	static bool sector(
+		std::int32_t x,
+		std::int32_t y,
+		point_t      ict,
+		std::int32_t radius,
+		std::int32_t start,
+		std::int32_t end
+	) noexcept {
+		return filled_circle(x, y, ict, radius) && wedge(x, y, ict, start, end);
+	}
+
+	INKNIT_NODISCARD
+	static bool ring(
+		std::int32_t x,
+		std::int32_t y,
+		point_t      ict,
+		std::int32_t radius,
+		std::int32_t thickness,
+		std::int32_t start,
+		std::int32_t end
+	) noexcept {
+		return sector(x, y, ict, radius, start, end)
+			&& !filled_circle(x, y, ict, radius - thickness);
+	}
+
+	// The pixels of the filled circle with a neighbour outside it, which is the midpoint circle
+	INKNIT_NODISCARD
+	static bool arc(
+		std::int32_t x,
+		std::int32_t y,
+		point_t      ict,
+		std::int32_t radius,
+		std::int32_t start,
+		std::int32_t end
+	) noexcept {
+		if (!sector(x, y, ict, radius, start, end)) {
+			return false;
+		}
+		return !filled_circle(x - 1, y, ict, radius) || !filled_circle(x + 1, y, ict, radius)
+			|| !filled_circle(x, y - 1, ict, radius) || !filled_circle(x, y + 1, ict, radius);
+	}
+
+	// A pixel is inside an outline when its center is, as in `polygon`, with the corners in
+	// 1/16 pixel
+	INKNIT_NODISCARD
+	static bool stroke(std::int32_t x, std::int32_t y, details::stroke_t const& istroke) noexcept {
+		std::int64_t const px = x * 16 + 8;
+		std::int64_t const py = y * 16 + 8;
+		for (std::vector<point_t> const& outline : istroke.outlines) {
+			std::int32_t crossings = 0;
+			for (std::size_t i = 0; i < outline.size(); ++i) {
+				auto [x1, y1] = outline[i];
+				auto [x2, y2] = outline[(i + 1) % outline.size()];
+				if (y1 == y2) {
+					continue;
+				}
+				if (y2 < y1) {
+					std::swap(x1, x2);
+					std::swap(y1, y2);
+				}
+				if (py < y1 || y2 <= py) {
+					continue;
+				}
+				if ((px - x1) * (y2 - y1) >= (py - y1) * (x2 - x1)) {
+					++crossings;
+				}
+			}
+			if ((crossings & 1) != 0) {
+				return true;
+			}
+		}
+		for (point_t const& disc : istroke.discs) {
+			if (filled_circle(x, y, disc, istroke.radius)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
 }  // namespace is_pixel_on
 
 static constexpr auto bind_all_pixels(color_t trueColor = colors::white) noexcept {
@@ -253,6 +622,104 @@ bind_is_pixel_on_list(pixel_list const& il, color_t trueColor = colors::white) n
 	);
 }
 
+INKNIT_NODISCARD
+static constexpr auto bind_is_pixel_on_polygon(
+	std::vector<inknit_point> const& ipoints, fill_rule rule, color_t trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::polygon, _1, _2, ipoints, rule)
+	);
+}
+
+INKNIT_NODISCARD
+static constexpr auto bind_is_pixel_on_round_rect(
+	point_t ipt, size_t isz, std::int32_t radius, color_t trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::round_rect, _1, _2, ipt, isz, radius)
+	);
+}
+
+INKNIT_NODISCARD
+static constexpr auto bind_is_pixel_on_round_rect_edge(
+	point_t      ipt,
+	size_t       isz,
+	std::int32_t radius,
+	std::int32_t thickness,
+	color_t      trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::round_rect_edge, _1, _2, ipt, isz, radius, thickness)
+	);
+}
+
+INKNIT_NODISCARD
+static auto bind_is_pixel_on_sector(
+	point_t      ict,
+	std::int32_t radius,
+	std::int32_t start,
+	std::int32_t end,
+	color_t      trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::sector, _1, _2, ict, radius, start, end)
+	);
+}
+
+INKNIT_NODISCARD
+static auto bind_is_pixel_on_ring(
+	point_t      ict,
+	std::int32_t radius,
+	std::int32_t thickness,
+	std::int32_t start,
+	std::int32_t end,
+	color_t      trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::ring, _1, _2, ict, radius, thickness, start, end)
+	);
+}
+
+INKNIT_NODISCARD
+static auto bind_is_pixel_on_arc(
+	point_t      ict,
+	std::int32_t radius,
+	std::int32_t start,
+	std::int32_t end,
+	color_t      trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::arc, _1, _2, ict, radius, start, end)
+	);
+}
+
+INKNIT_NODISCARD
+static auto bind_is_pixel_on_thick_polyline(
+	std::vector<inknit_point> const& ipoints,
+	std::int32_t                     thickness,
+	line_join                        join,
+	color_t                          trueColor = colors::white
+) noexcept {
+	using namespace std::placeholders;
+	details::stroke_t const stroke = details::make_thick_polyline(ipoints, thickness, join);
+	return details::compose(
+		std::bind(details::boolean_to_color, _1, trueColor),
+		std::bind(is_pixel_on::stroke, _1, _2, stroke)
+	);
+}
+
 namespace details {
 
 	constexpr void add_point(